@@ -0,0 +1,236 @@
+/**
+ * @file durableLogger.cpp
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Test App to check Cpp Logger durability modes and group commit
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ * Usage: durableLogger
+ * Each check logs to a file from a child process (new Logger instance) and
+ * counts the fdatasync calls. Returns non zero if any check fails.
+ */
+// System Includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// CppLogger Include
+#include <CppLogger.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Path of the log file
+#define LOG_FILE_PATH "durableLogger.log"
+// Number of logging threads
+#define THREAD_COUNT 8
+// Number of logs per thread
+#define LOGS_PER_THREAD 200
+
+// Number of fdatasync calls
+static std::atomic<unsigned long long> s_syncs(0);
+// Flag to fail the fdatasync calls (as on a disk error)
+static std::atomic<bool> s_isSyncFailing(false);
+
+extern "C" int fdatasync(int fd)
+{
+    s_syncs++;
+    if (s_isSyncFailing)
+    {
+        errno = EIO;
+        return -1;
+    }
+    return static_cast<int>(syscall(SYS_fdatasync, fd));
+}
+
+/**
+ * @brief Counts the logs in the log file (Logger prints of the setters are skipped)
+ *
+ * @return unsigned long long : number of logs
+ */
+static unsigned long long countLogLines()
+{
+    FILE *file = fopen(LOG_FILE_PATH, "r");
+    if (NULL == file)
+        return 0;
+
+    unsigned long long lines = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL)
+        lines += (line[0] == '[');
+    fclose(file);
+    return lines;
+}
+
+/**
+ * @brief Runs the check in a child process (Logger can be configured once per process)
+ *
+ * @param name name of the check
+ * @param check check to run in the child, returns true on success
+ * @return true
+ * @return false
+ */
+static bool runCheck(const char *name, bool (*check)())
+{
+    pid_t pid = fork();
+    if (0 == pid)
+    {
+        unsetenv("LOG_LEVEL");
+        unsetenv("LOG_STREAM");
+        unsetenv("LOG_FILE");
+
+        // Logger prints go to the log file, results are printed on stderr
+        Logger::getInstance().setLogLevel(Logger::LOG_INFO);
+        Logger::getInstance().setLogStream(Logger::STDOUT);
+        Logger::getInstance().setLogFile(LOG_FILE_PATH);
+        exit(check() ? 0 : 1);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    bool isPassed = WIFEXITED(status) && (0 == WEXITSTATUS(status));
+    fprintf(stderr, "%s: %s\n", name, isPassed ? "PASSED" : "FAILED");
+    return isPassed;
+}
+
+/**
+ * @brief Checks no sync is done by default, and flush(true) syncs once
+ *
+ * @return true
+ * @return false
+ */
+static bool checkNone()
+{
+    for (int i = 0; i < LOGS_PER_THREAD; i++)
+        Logger::getInstance().error("error %d", i);
+    unsigned long long syncsBeforeFlush = s_syncs;
+
+    bool isFlushed = Logger::getInstance().flush(true);
+    unsigned long long syncs = s_syncs;
+
+    fprintf(stderr, "  %llu syncs for %d logs, %llu after flush(true)\n", syncsBeforeFlush, LOGS_PER_THREAD, syncs);
+    return isFlushed && (0 == syncsBeforeFlush) && (1 == syncs) && (LOGS_PER_THREAD == countLogLines());
+}
+
+/**
+ * @brief Checks synchronous logs from many threads share fdatasync calls (group commit)
+ *
+ * @return true
+ * @return false
+ */
+static bool checkSyncOnLevel()
+{
+    Logger::getInstance().setLogDurability(Logger::DURABILITY_SYNC_ON_LEVEL, 0, Logger::LOG_ERROR);
+
+    // Logs above the sync level do not sync
+    for (int i = 0; i < LOGS_PER_THREAD; i++)
+        Logger::getInstance().info("info %d", i);
+    unsigned long long infoSyncs = s_syncs;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(std::thread([t] {
+            for (int i = 0; i < LOGS_PER_THREAD; i++)
+                Logger::getInstance().error("thread %d error %d", t, i);
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+    unsigned long long errorSyncs = s_syncs - infoSyncs;
+
+    // Every error log returned after a sync, so everything is on disk without flush
+    unsigned long long lines = countLogLines();
+
+    fprintf(stderr, "  %llu syncs for %d info logs, %llu syncs for %d error logs, %llu lines\n",
+            infoSyncs, LOGS_PER_THREAD, errorSyncs, THREAD_COUNT * LOGS_PER_THREAD, lines);
+    return (0 == infoSyncs) && (errorSyncs > 0) && (errorSyncs < THREAD_COUNT * LOGS_PER_THREAD) &&
+           (lines == (THREAD_COUNT + 1) * LOGS_PER_THREAD);
+}
+
+/**
+ * @brief Checks a failed sync is reported by flush(true), also after later syncs succeed
+ *
+ * @return true
+ * @return false
+ */
+static bool checkSyncError()
+{
+    Logger::getInstance().setLogDurability(Logger::DURABILITY_SYNC_ON_LEVEL, 0, Logger::LOG_ERROR);
+
+    Logger::getInstance().error("error before failure");
+    bool isFlushedBefore = Logger::getInstance().flush(true);
+
+    // Error logs still return when the sync fails, and share the failed syncs
+    s_isSyncFailing = true;
+    unsigned long long syncsBefore = s_syncs;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(std::thread([t] {
+            for (int i = 0; i < LOGS_PER_THREAD; i++)
+                Logger::getInstance().error("thread %d error %d", t, i);
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+    unsigned long long failedSyncs = s_syncs - syncsBefore;
+    bool isFlushedFailing = Logger::getInstance().flush(true);
+
+    // Disk works again, lost logs are still reported
+    s_isSyncFailing = false;
+    Logger::getInstance().error("error after failure");
+    bool isFlushedAfter = Logger::getInstance().flush(true);
+
+    fprintf(stderr, "  flush(true) %s before, %s while failing (%llu failed syncs), %s after\n",
+            isFlushedBefore ? "true" : "false", isFlushedFailing ? "true" : "false", failedSyncs,
+            isFlushedAfter ? "true" : "false");
+    return isFlushedBefore && !isFlushedFailing && !isFlushedAfter && (failedSyncs > 0) &&
+           (failedSyncs <= THREAD_COUNT * LOGS_PER_THREAD + 1);
+}
+
+/**
+ * @brief Checks periodic sync
+ *
+ * @return true
+ * @return false
+ */
+static bool checkPeriodic()
+{
+    Logger::getInstance().setLogDurability(Logger::DURABILITY_PERIODIC, 50, Logger::LOG_OFF);
+
+    // Log for about 500 ms, about 10 periods
+    for (int i = 0; i < 50; i++)
+    {
+        Logger::getInstance().info("info %d", i);
+        usleep(10 * 1000);
+    }
+    unsigned long long syncs = s_syncs;
+
+    fprintf(stderr, "  %llu syncs in 500 ms with 50 ms period\n", syncs);
+    return (syncs >= 2) && (syncs <= 20);
+}
+
+int main(int argc, char const *argv[])
+{
+    bool isPassed = runCheck("none", checkNone);
+    isPassed = runCheck("sync on level", checkSyncOnLevel) && isPassed;
+    isPassed = runCheck("sync error", checkSyncError) && isPassed;
+    isPassed = runCheck("periodic", checkPeriodic) && isPassed;
+
+    fprintf(stderr, "%s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? 0 : 1;
+}
+#else
+int main(int argc, char const *argv[])
+{
+    fprintf(stderr, "Durability check needs Linux, skipped\n");
+    return 0;
+}
+#endif // __linux__
@@ -0,0 +1,228 @@
+/**
+ * @file hexLogger.cpp
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Test App to check the Cpp Logger hex kernels against the scalar kernel, and measure them
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ * Usage: hexLogger [benchmark rounds]
+ * Every kernel available on this CPU is run on every length / tail / alignment
+ * and compared with the scalar kernel. The benchmark encodes a 64 KiB buffer
+ * (0 rounds to skip). Returns non zero if any check fails.
+ */
+// System Includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Logger Internal Include
+#include "CppLoggerHex.h"
+
+// Kernels to check
+static const char *kernelNames[] = {"scalar", "sse2", "avx2"};
+// Longest buffer checked (covers the 16 / 32 byte blocks, hexdump chunks and their tails)
+#define CHECK_MAX_LENGTH 600
+// Misalignments of the source and destination checked
+#define CHECK_MAX_OFFSET 32
+// Size of the benchmark buffer
+#define BENCHMARK_LENGTH (64 * 1024)
+
+/**
+ * @brief Checks the hex and ASCII output of the kernel against the scalar kernel
+ *
+ * Bytes around the output must not be written.
+ *
+ * @param name kernel name
+ * @param src source bytes (all byte values)
+ * @return true
+ * @return false
+ */
+static bool checkKernel(const char *name, const unsigned char *src)
+{
+    std::vector<char> expected(2 * CHECK_MAX_LENGTH + 2 * CHECK_MAX_OFFSET);
+    std::vector<char> actual(2 * CHECK_MAX_LENGTH + 2 * CHECK_MAX_OFFSET);
+
+    for (int isAscii = 0; isAscii < 2; isAscii++)
+    {
+        for (size_t offset = 0; offset < CHECK_MAX_OFFSET; offset++)
+        {
+            for (size_t length = 0; length <= CHECK_MAX_LENGTH; length++)
+            {
+                size_t outLength = isAscii ? length : 2 * length;
+                memset(expected.data(), '#', expected.size());
+                memset(actual.data(), '#', actual.size());
+                encodeWithHexKernel("scalar", isAscii != 0, expected.data() + offset, src + offset, length);
+                encodeWithHexKernel(name, isAscii != 0, actual.data() + offset, src + offset, length);
+
+                if (memcmp(expected.data(), actual.data(), actual.size()) != 0)
+                {
+                    fprintf(stderr, "  %s %s: mismatch at length %zu offset %zu (%zu characters)\n",
+                            name, isAscii ? "ascii" : "hex", length, offset, outLength);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks hexdump lines against lines formatted with snprintf
+ *
+ * @param src source bytes
+ * @return true
+ * @return false
+ */
+static bool checkHexDump(const unsigned char *src)
+{
+    std::vector<char> actual(CHECK_MAX_LENGTH * 5 + 100);
+    for (size_t length = 0; length <= CHECK_MAX_LENGTH; length++)
+    {
+        std::string expected;
+        for (size_t line = 0; line < length; line += LOG_HEX_DUMP_LINE_BYTES)
+        {
+            char text[LOG_HEX_DUMP_LINE_SIZE + 8];
+            int position = snprintf(text, sizeof(text), "%08zx ", line);
+            for (size_t i = 0; i < LOG_HEX_DUMP_LINE_BYTES; i++)
+            {
+                if (i % 8 == 0)
+                    text[position++] = ' ';
+                if (line + i < length)
+                    position += snprintf(text + position, sizeof(text) - position, "%02x ", src[line + i]);
+                else
+                    position += snprintf(text + position, sizeof(text) - position, "   ");
+            }
+            text[position++] = ' ';
+            text[position++] = '|';
+            for (size_t i = 0; i < LOG_HEX_DUMP_LINE_BYTES && line + i < length; i++)
+            {
+                unsigned char c = src[line + i];
+                text[position++] = (c >= 0x20 && c < 0x7f) ? static_cast<char>(c) : '.';
+            }
+            text[position++] = '|';
+            if (!expected.empty())
+                expected += '\n';
+            expected.append(text, position);
+        }
+
+        size_t actualLength = encodeHexDump(actual.data(), src, length);
+        if (actualLength != expected.size() || memcmp(actual.data(), expected.data(), actualLength) != 0)
+        {
+            fprintf(stderr, "  hexdump: mismatch at length %zu\n%.*s\n%s\n",
+                    length, static_cast<int>(actualLength), actual.data(), expected.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks buffers cut to the available space are marked with "..." and never overrun
+ *
+ * @param src source bytes
+ * @return true
+ * @return false
+ */
+static bool checkTruncation(const unsigned char *src)
+{
+    const size_t length = 100;
+    std::vector<char> text(CHECK_MAX_LENGTH * 5 + 100);
+    for (int isHexDump = 0; isHexDump < 2; isHexDump++)
+    {
+        size_t fullLength = isHexDump ? encodeHexDump(text.data(), src, length) : 2 * length;
+        for (size_t available = 0; available < 600; available++)
+        {
+            memset(text.data(), '#', text.size());
+            size_t textLength = encodeHexText(text.data(), available, src, length, 0, isHexDump != 0);
+
+            bool isPassed = (textLength <= available) && (text[available] == '#');
+            if (textLength == fullLength)
+                isPassed = isPassed && (available >= fullLength);
+            else if (available >= 3)
+                isPassed = isPassed && (textLength >= 3) && (memcmp(text.data() + textLength - 3, "...", 3) == 0);
+            if (!isPassed)
+            {
+                fprintf(stderr, "  %s: truncation at %zu available\n", isHexDump ? "hexdump" : "hex", available);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Measures the kernel on the benchmark buffer
+ *
+ * @param name kernel name ("snprintf" for the snprintf("%02x") loop)
+ * @param src source bytes
+ * @param rounds number of rounds
+ */
+static void benchmark(const char *name, const unsigned char *src, long rounds)
+{
+    std::vector<char> text(2 * BENCHMARK_LENGTH + 1);
+    bool isSnprintf = (strcmp(name, "snprintf") == 0);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long round = 0; round < rounds; round++)
+    {
+        if (isSnprintf)
+        {
+            for (size_t i = 0; i < BENCHMARK_LENGTH; i++)
+                snprintf(text.data() + 2 * i, 3, "%02x", src[i]);
+        }
+        else if (!encodeWithHexKernel(name, false, text.data(), src, BENCHMARK_LENGTH))
+        {
+            return;
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Keep the output alive
+    volatile char last = text[2 * BENCHMARK_LENGTH - 1];
+    (void)last;
+    fprintf(stderr, "  %-8s: %.3f ns/byte\n", name, elapsed.count() / (static_cast<double>(rounds) * BENCHMARK_LENGTH));
+}
+
+int main(int argc, char const *argv[])
+{
+    long rounds = (argc > 1) ? atol(argv[1]) : 200;
+
+    // All byte values, repeated
+    std::vector<unsigned char> src(BENCHMARK_LENGTH);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<unsigned char>(i * 7 + (i >> 8));
+
+    bool isPassed = true;
+    for (unsigned int i = 0; i < sizeof(kernelNames) / sizeof(kernelNames[0]); i++)
+    {
+        char probe[2];
+        if (!encodeWithHexKernel(kernelNames[i], false, probe, src.data(), 1))
+        {
+            fprintf(stderr, "%s: not available, skipped\n", kernelNames[i]);
+            continue;
+        }
+        bool isKernelPassed = checkKernel(kernelNames[i], src.data());
+        fprintf(stderr, "%s: %s\n", kernelNames[i], isKernelPassed ? "PASSED" : "FAILED");
+        isPassed = isPassed && isKernelPassed;
+    }
+
+    bool isHexDumpPassed = checkHexDump(src.data());
+    fprintf(stderr, "hexdump (%s kernel): %s\n", hexKernelName(), isHexDumpPassed ? "PASSED" : "FAILED");
+    bool isTruncationPassed = checkTruncation(src.data());
+    fprintf(stderr, "truncation: %s\n", isTruncationPassed ? "PASSED" : "FAILED");
+    isPassed = isPassed && isHexDumpPassed && isTruncationPassed;
+
+    if (rounds > 0)
+    {
+        fprintf(stderr, "benchmark (%d bytes, %ld rounds):\n", BENCHMARK_LENGTH, rounds);
+        benchmark("snprintf", src.data(), (rounds + 99) / 100);
+        for (unsigned int i = 0; i < sizeof(kernelNames) / sizeof(kernelNames[0]); i++)
+            benchmark(kernelNames[i], src.data(), rounds);
+    }
+
+    fprintf(stderr, "%s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,462 @@
+/**
+ * @file socketLogger.cpp
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Test App to check Cpp Logger socket sink against a local listener
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ * Usage: socketLogger
+ * Each check logs from a child process (new Logger instance) to a Unix-domain
+ * listener in this process. Returns non zero if any check fails.
+ */
+// System Includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// CppLogger Include
+#include <CppLogger.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <unistd.h>
+#include <signal.h>
+
+// Path of the listener socket
+#define SOCKET_PATH "socketLogger.sock"
+// Seconds given to a child before it is considered hung
+#define CHILD_TIMEOUT_SEC 10
+
+/**
+ * @brief Logging done by the child process
+ */
+struct ChildLogs
+{
+    // Socket type
+    Logger::LogSocketType type;
+    // Record format
+    Logger::LogSocketFormat format;
+    // Number of logs
+    int count;
+    // Size of padding added to each log
+    int padding;
+    // Pause (ms) between first and second half of the logs, 0 for no pause
+    int pauseMs;
+    // Minimum number of dropped logs expected
+    unsigned long long minDropped;
+    // Maximum number of dropped logs expected
+    unsigned long long maxDropped;
+    // Expected result of flush() after logging (0 / 1), -1 for no flush
+    int flushResult;
+};
+
+/**
+ * @brief Creates the listener socket
+ *
+ * @param type socket type (SOCK_DGRAM / SOCK_STREAM)
+ * @return int : socket, -1 on failure
+ */
+static int createListener(int type)
+{
+    unlink(SOCKET_PATH);
+    int fd = socket(AF_UNIX, type, 0);
+    if (fd < 0)
+        return -1;
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, SOCKET_PATH, sizeof(addr.sun_path) - 1);
+    if (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    if (SOCK_STREAM == type)
+        listen(fd, 1);
+    return fd;
+}
+
+/**
+ * @brief Starts the child process which logs to the listener and exits
+ *
+ * Exit code is 0 if flush() and the dropped logs are as expected.
+ *
+ * @param logs logging done by the child
+ * @return pid_t : child process
+ */
+static pid_t startChild(const ChildLogs &logs)
+{
+    pid_t pid = fork();
+    if (pid != 0)
+        return pid;
+
+    // Shutdown must not hang, even if the listener does not read
+    alarm(CHILD_TIMEOUT_SEC);
+    unsetenv("LOG_LEVEL");
+    unsetenv("LOG_SOCKET");
+
+    Logger::getInstance().setLogLevel(Logger::LOG_INFO);
+    Logger::getInstance().setLogSocket(SOCKET_PATH, logs.type, logs.format);
+
+    std::string padding(logs.padding, 'p');
+    for (int i = 0; i < logs.count; i++)
+    {
+        if (logs.pauseMs > 0 && i == logs.count / 2)
+            usleep(logs.pauseMs * 1000);
+        Logger::getInstance().info("record %d%s", i, padding.c_str());
+    }
+
+    // flush() waits for the listener, but not forever
+    bool isFlushPassed = true;
+    if (logs.flushResult >= 0)
+    {
+        bool isFlushed = Logger::getInstance().flush(false);
+        fprintf(stderr, "  child: flush %s\n", isFlushed ? "done" : "timed out");
+        isFlushPassed = (isFlushed == (1 == logs.flushResult));
+    }
+
+    unsigned long long dropped = Logger::getInstance().getDroppedLogCount();
+    fprintf(stderr, "  child: %llu dropped\n", dropped);
+    exit((isFlushPassed && dropped >= logs.minDropped && dropped <= logs.maxDropped) ? 0 : 1);
+}
+
+/**
+ * @brief Waits for the child and checks its exit code
+ *
+ * @param pid child process
+ * @return true : child exited with 0
+ * @return false
+ */
+static bool waitChild(pid_t pid)
+{
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFSIGNALED(status))
+        fprintf(stderr, "  child killed by signal %d\n", WTERMSIG(status));
+    return WIFEXITED(status) && (0 == WEXITSTATUS(status));
+}
+
+/**
+ * @brief Reads from the socket until no data arrives for the timeout
+ *
+ * @param fd socket
+ * @param timeoutMs idle timeout
+ * @param datagrams received datagrams (SOCK_DGRAM), or NULL
+ * @param stream received bytes (SOCK_STREAM), or NULL
+ * @return true : peer closed the stream
+ * @return false : idle timeout
+ */
+static bool receiveAll(int fd, int timeoutMs, std::vector<std::string> *datagrams, std::string *stream)
+{
+    char buffer[65536];
+    while (true)
+    {
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, timeoutMs) <= 0)
+            return false;
+        ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+        if (length <= 0)
+            return true;
+        if (NULL != datagrams)
+            datagrams->push_back(std::string(buffer, length));
+        else
+            stream->append(buffer, length);
+    }
+}
+
+/**
+ * @brief Checks the log (without framing) is the expected record
+ *
+ * @param log received log
+ * @param format record format
+ * @param index expected record number
+ * @return true
+ * @return false
+ */
+static bool isExpectedLog(const std::string &log, Logger::LogSocketFormat format, int index)
+{
+    std::string suffix = "record " + std::to_string(index);
+    if (log.size() < suffix.size() || log.compare(log.size() - suffix.size(), suffix.size(), suffix) != 0)
+        return false;
+    if (Logger::SOCKET_FORMAT_SYSLOG == format)
+        return log.compare(0, 6, "<14>1 ") == 0 && log.find(" INFO - record ") != std::string::npos;
+    return log[0] == '[' && log.find("]:[INFO] record ") != std::string::npos;
+}
+
+/**
+ * @brief Splits the stream into logs based on the framing
+ *
+ * @param stream received bytes
+ * @param format record format (newline or octet counting framing)
+ * @param logs split logs
+ * @return true : framing is valid
+ * @return false
+ */
+static bool splitStream(const std::string &stream, Logger::LogSocketFormat format, std::vector<std::string> *logs)
+{
+    size_t position = 0;
+    while (position < stream.size())
+    {
+        if (Logger::SOCKET_FORMAT_SYSLOG == format)
+        {
+            // Octet counting (RFC 6587): "LENGTH SP MSG"
+            size_t space = stream.find(' ', position);
+            if (std::string::npos == space)
+                return false;
+            size_t length = strtoul(stream.substr(position, space - position).c_str(), NULL, 10);
+            if (0 == length || space + 1 + length > stream.size())
+                return false;
+            logs->push_back(stream.substr(space + 1, length));
+            position = space + 1 + length;
+        }
+        else
+        {
+            size_t newline = stream.find('\n', position);
+            if (std::string::npos == newline)
+                return false;
+            logs->push_back(stream.substr(position, newline - position));
+            position = newline + 1;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks all logs are delivered in order, with the right format and framing
+ *
+ * @param type socket type
+ * @param format record format
+ * @return true
+ * @return false
+ */
+static bool checkDelivery(Logger::LogSocketType type, Logger::LogSocketFormat format)
+{
+    const int count = 500;
+    bool isStream = (Logger::SOCKET_STREAM == type);
+    int listener = createListener(isStream ? SOCK_STREAM : SOCK_DGRAM);
+    if (listener < 0)
+        return false;
+
+    pid_t pid = startChild(ChildLogs{type, format, count, 0, 0, 0, 0, 1});
+
+    std::vector<std::string> logs;
+    bool isFramed = true;
+    if (isStream)
+    {
+        int connection = accept(listener, NULL, NULL);
+        std::string stream;
+        receiveAll(connection, 2000, NULL, &stream);
+        close(connection);
+        isFramed = splitStream(stream, format, &logs);
+    }
+    else
+    {
+        receiveAll(listener, 2000, &logs, NULL);
+    }
+    bool isChildPassed = waitChild(pid);
+    close(listener);
+
+    bool isDelivered = isFramed && (logs.size() == static_cast<size_t>(count));
+    for (size_t i = 0; isDelivered && i < logs.size(); i++)
+        isDelivered = isExpectedLog(logs[i], format, static_cast<int>(i));
+
+    fprintf(stderr, "  %zu of %d logs received, framing %s\n", logs.size(), count, isFramed ? "valid" : "invalid");
+    return isChildPassed && isDelivered;
+}
+
+/**
+ * @brief Checks logs are dropped (and the child exits) when the listener is missing
+ *
+ * @return true
+ * @return false
+ */
+static bool checkMissingListener()
+{
+    unlink(SOCKET_PATH);
+
+    // Queue holds 1024 logs, the rest are dropped while connecting, all are dropped on exit
+    pid_t pid = startChild(ChildLogs{Logger::SOCKET_DATAGRAM, Logger::SOCKET_FORMAT_PLAIN, 5000, 0, 0, 5000 - 1024, 5000, 0});
+    return waitChild(pid);
+}
+
+/**
+ * @brief Checks logs are dropped, flush() times out and the child exits when the listener does not read
+ *
+ * @return true
+ * @return false
+ */
+static bool checkSlowListener()
+{
+    int listener = createListener(SOCK_STREAM);
+    if (listener < 0)
+        return false;
+
+    // Large logs fill the socket buffer, then the queue
+    pid_t pid = startChild(ChildLogs{Logger::SOCKET_STREAM, Logger::SOCKET_FORMAT_PLAIN, 5000, 1000, 0, 1, 5000, 0});
+
+    // Accept, but never read
+    int connection = accept(listener, NULL, NULL);
+    bool isChildPassed = waitChild(pid);
+    close(connection);
+    close(listener);
+    return isChildPassed;
+}
+
+/**
+ * @brief Checks the sink reconnects when the listener closes the connection
+ *
+ * @return true
+ * @return false
+ */
+static bool checkReconnect()
+{
+    const int count = 200;
+    int listener = createListener(SOCK_STREAM);
+    if (listener < 0)
+        return false;
+
+    // First half, pause, second half
+    pid_t pid = startChild(ChildLogs{Logger::SOCKET_STREAM, Logger::SOCKET_FORMAT_PLAIN, count, 0, 500, 0, 0, 1});
+
+    // Read the first half, then drop the connection
+    int connection = accept(listener, NULL, NULL);
+    std::string first;
+    receiveAll(connection, 300, NULL, &first);
+    close(connection);
+
+    // Second half arrives on a new connection
+    connection = accept(listener, NULL, NULL);
+    std::string second;
+    receiveAll(connection, 2000, NULL, &second);
+    close(connection);
+
+    bool isChildPassed = waitChild(pid);
+    close(listener);
+
+    std::vector<std::string> logs;
+    bool isDelivered = splitStream(first + second, Logger::SOCKET_FORMAT_PLAIN, &logs) &&
+                       (logs.size() == static_cast<size_t>(count));
+    for (size_t i = 0; isDelivered && i < logs.size(); i++)
+        isDelivered = isExpectedLog(logs[i], Logger::SOCKET_FORMAT_PLAIN, static_cast<int>(i));
+
+    fprintf(stderr, "  %zu of %d logs received over 2 connections\n", logs.size(), count);
+    return isChildPassed && isDelivered;
+}
+
+/**
+ * @brief Checks a hex log larger than a record is cut to the record and marked with "..."
+ *
+ * On newline framed sockets (stream, plain format) hexdump must be sent as plain hex, in one record.
+ *
+ * @param type socket type
+ * @param hexFormat format of the buffer
+ * @return true
+ * @return false
+ */
+static bool checkHexRecord(Logger::LogSocketType type, Logger::LogHexFormat hexFormat)
+{
+    const size_t maxRecordLength = 2031;
+    bool isStream = (Logger::SOCKET_STREAM == type);
+    int listener = createListener(isStream ? SOCK_STREAM : SOCK_DGRAM);
+    if (listener < 0)
+        return false;
+
+    pid_t pid = fork();
+    if (0 == pid)
+    {
+        alarm(CHILD_TIMEOUT_SEC);
+        unsetenv("LOG_LEVEL");
+        unsetenv("LOG_SOCKET");
+
+        static unsigned char packet[4096];
+        for (unsigned int i = 0; i < sizeof(packet); i++)
+            packet[i] = static_cast<unsigned char>(i);
+
+        Logger::getInstance().setLogLevel(Logger::LOG_INFO);
+        Logger::getInstance().setLogSocket(SOCKET_PATH, type, Logger::SOCKET_FORMAT_PLAIN);
+        Logger::getInstance().setHexFormat(hexFormat, sizeof(packet));
+        Logger::getInstance().infoHex("packet", packet, sizeof(packet));
+        Logger::getInstance().info("record 0");
+        exit(Logger::getInstance().flush(false) ? 0 : 1);
+    }
+
+    std::vector<std::string> logs;
+    bool isFramed = true;
+    if (isStream)
+    {
+        int connection = accept(listener, NULL, NULL);
+        std::string stream;
+        receiveAll(connection, 2000, NULL, &stream);
+        close(connection);
+        isFramed = splitStream(stream, Logger::SOCKET_FORMAT_PLAIN, &logs);
+    }
+    else
+    {
+        receiveAll(listener, 2000, &logs, NULL);
+    }
+    bool isChildPassed = waitChild(pid);
+    close(listener);
+
+    // Hex log, then the next log as its own record
+    if (!isFramed || logs.size() != 2 || !isExpectedLog(logs[1], Logger::SOCKET_FORMAT_PLAIN, 0))
+    {
+        fprintf(stderr, "  %zu logs received, framing %s\n", logs.size(), isFramed ? "valid" : "invalid");
+        return false;
+    }
+
+    const std::string &log = logs[0];
+    bool isHexDump = (Logger::HEX_DUMP == hexFormat) && !isStream;
+    const char *prefix = isHexDump ? "]:[INFO] packet [4096 bytes]:\n00000000  00 01 02 03" :
+                                     "]:[INFO] packet [4096 bytes]: 000102030405";
+    bool isCut = (log.size() <= maxRecordLength) && (log.size() > maxRecordLength - 100) &&
+                 (log.compare(log.size() - 3, 3, "...") == 0) && (log.find(prefix) != std::string::npos);
+    fprintf(stderr, "  %zu characters received, %s\n", log.size(), isCut ? "marked" : "not marked");
+    return isChildPassed && isCut;
+}
+
+int main(int argc, char const *argv[])
+{
+    // Listener closing the connection must not kill this process
+    signal(SIGPIPE, SIG_IGN);
+
+    struct
+    {
+        const char *name;
+        bool isPassed;
+    } checks[] = {
+        {"datagram plain", checkDelivery(Logger::SOCKET_DATAGRAM, Logger::SOCKET_FORMAT_PLAIN)},
+        {"datagram syslog", checkDelivery(Logger::SOCKET_DATAGRAM, Logger::SOCKET_FORMAT_SYSLOG)},
+        {"stream plain", checkDelivery(Logger::SOCKET_STREAM, Logger::SOCKET_FORMAT_PLAIN)},
+        {"stream syslog", checkDelivery(Logger::SOCKET_STREAM, Logger::SOCKET_FORMAT_SYSLOG)},
+        {"missing listener", checkMissingListener()},
+        {"slow listener", checkSlowListener()},
+        {"reconnect", checkReconnect()},
+        {"datagram hex plain", checkHexRecord(Logger::SOCKET_DATAGRAM, Logger::HEX_PLAIN)},
+        {"datagram hex dump", checkHexRecord(Logger::SOCKET_DATAGRAM, Logger::HEX_DUMP)},
+        {"stream plain hex dump", checkHexRecord(Logger::SOCKET_STREAM, Logger::HEX_DUMP)},
+    };
+    unlink(SOCKET_PATH);
+
+    bool isPassed = true;
+    for (unsigned int i = 0; i < sizeof(checks) / sizeof(checks[0]); i++)
+    {
+        fprintf(stderr, "%s: %s\n", checks[i].name, checks[i].isPassed ? "PASSED" : "FAILED");
+        isPassed = isPassed && checks[i].isPassed;
+    }
+
+    fprintf(stderr, "%s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? 0 : 1;
+}
+#else
+int main(int argc, char const *argv[])
+{
+    fprintf(stderr, "Socket check needs Unix-domain sockets, skipped\n");
+    return 0;
+}
+#endif // _WIN32
@@ -0,0 +1,336 @@
+/**
+ * @file zeroAllocLogger.cpp
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Test App to check Cpp Logger does not allocate memory after warm-up
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ * Usage: zeroAllocLogger [iterations]
+ * Console logs go to /dev/null, results are printed on stderr. Returns non
+ * zero if any allocation is found, or if freed Logger storage is used.
+ */
+// System Includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// CppLogger Include
+#include <CppLogger.h>
+
+#ifdef __GLIBC__
+#include <unistd.h>
+
+// glibc allocator functions, used by the interposed functions below
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void *__libc_memalign(size_t alignment, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+// Flag to count the allocations
+static std::atomic<bool> s_isCounting(false);
+// Number of allocations while counting
+static std::atomic<unsigned long long> s_allocations(0);
+// Number of frees while counting
+static std::atomic<unsigned long long> s_frees(0);
+
+extern "C" void *malloc(size_t size)
+{
+    if (s_isCounting)
+        s_allocations++;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    if (s_isCounting)
+        s_allocations++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    if (s_isCounting)
+        s_allocations++;
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    if (s_isCounting)
+        s_allocations++;
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    return memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    *ptr = memalign(alignment, size);
+    return (NULL == *ptr) ? ENOMEM : 0;
+}
+
+extern "C" void free(void *ptr)
+{
+    if (s_isCounting && (NULL != ptr))
+        s_frees++;
+    __libc_free(ptr);
+}
+
+// Number of logging threads in the worker phase
+#define WORKER_COUNT 4
+// Number of blocks tracked by the checking allocator
+#define CHECK_BLOCK_COUNT 256
+// Pattern of the blocks freed by the Logger
+#define FREED_PATTERN 0xdd
+
+/**
+ * @brief Block given to the Logger by the checking allocator
+ */
+struct CheckBlock
+{
+    // Memory of the block
+    unsigned char *ptr;
+    // Size of the block
+    size_t size;
+    // Flag to check the Logger freed the block (memory is kept, filled with FREED_PATTERN)
+    bool isFreed;
+};
+
+// Blocks given to the Logger
+static CheckBlock s_blocks[CHECK_BLOCK_COUNT];
+// Number of blocks given to the Logger
+static size_t s_blockCount = 0;
+// Number of blocks freed twice by the Logger
+static size_t s_doubleFrees = 0;
+// Protects the blocks
+static std::mutex s_blockMutex;
+
+/**
+ * @brief Allocator for the Logger, blocks freed by the Logger are kept to find later use
+ */
+static void *checkAllocate(size_t size, void *context)
+{
+    (void)context;
+    unsigned char *ptr = static_cast<unsigned char *>(malloc(size));
+    std::lock_guard<std::mutex> lock(s_blockMutex);
+    if (NULL != ptr && s_blockCount < CHECK_BLOCK_COUNT)
+        s_blocks[s_blockCount++] = CheckBlock{ptr, size, false};
+    return ptr;
+}
+
+static void checkDeallocate(void *ptr, size_t size, void *context)
+{
+    (void)context;
+    std::lock_guard<std::mutex> lock(s_blockMutex);
+    for (size_t i = 0; i < s_blockCount; i++)
+    {
+        if (s_blocks[i].ptr != ptr)
+            continue;
+        if (s_blocks[i].isFreed)
+            s_doubleFrees++;
+        s_blocks[i].isFreed = true;
+        memset(ptr, FREED_PATTERN, size);
+        return;
+    }
+    free(ptr);
+}
+
+/**
+ * @brief Checks the blocks freed by the Logger were not written or freed again
+ *
+ * @return true
+ * @return false
+ */
+static bool checkFreedBlocks()
+{
+    std::lock_guard<std::mutex> lock(s_blockMutex);
+    size_t writtenBlocks = 0;
+    for (size_t i = 0; i < s_blockCount; i++)
+    {
+        for (size_t j = 0; s_blocks[i].isFreed && j < s_blocks[i].size; j++)
+        {
+            if (s_blocks[i].ptr[j] != FREED_PATTERN)
+            {
+                writtenBlocks++;
+                break;
+            }
+        }
+    }
+    fprintf(stderr, "%zu blocks, %zu written after free, %zu freed twice\n", s_blockCount, writtenBlocks, s_doubleFrees);
+    return (0 == writtenBlocks) && (0 == s_doubleFrees);
+}
+
+/**
+ * @brief Logs long messages from a static destructor, after the buffer of the main thread is destroyed
+ */
+struct ExitLogger
+{
+    ~ExitLogger()
+    {
+        static char longMessage[6000];
+        memset(longMessage, 'e', sizeof(longMessage) - 1);
+
+        // Same size twice (storage reused), then longer (storage grown)
+        Logger::getInstance().info("Exit Logs %.3000s", longMessage);
+        Logger::getInstance().info("Exit Logs %.3000s", longMessage);
+        Logger::getInstance().info("Exit Logs %s", longMessage);
+
+        bool isPassed = checkFreedBlocks();
+        fprintf(stderr, "exit logs: %s\n", isPassed ? "PASSED" : "FAILED");
+        if (!isPassed)
+            _exit(1);
+    }
+};
+
+/**
+ * @brief Logs the same kinds of logs as the measured loop
+ *
+ * @param iterations number of iterations
+ * @param longMessage message longer than the record buffer of the thread
+ */
+static void logAll(long iterations, const char *longMessage)
+{
+    unsigned char packet[64];
+    for (unsigned int i = 0; i < sizeof(packet); i++)
+        packet[i] = static_cast<unsigned char>(i);
+
+    for (long i = 0; i < iterations; i++)
+    {
+        Logger::getInstance().info("Info Logs %ld %s %f", i, "text", 1.5);
+        Logger::getInstance().debug("Debug Logs %ld", i);
+        if (i % 1000 == 0)
+        {
+            Logger::getInstance().debug("Long Logs %s", longMessage);
+            Logger::getInstance().debugHex("packet", packet, sizeof(packet));
+        }
+    }
+}
+
+/**
+ * @brief Checks the allocations done while logging
+ *
+ * @param name name of the path (console / file)
+ * @param iterations number of iterations
+ * @param longMessage message longer than the record buffer of the thread
+ * @return true : no allocation
+ * @return false
+ */
+static bool checkAllocations(const char *name, long iterations, const char *longMessage)
+{
+    // Warm-up: stdio buffers, time zone, thread local buffers
+    logAll(2000, longMessage);
+
+    s_allocations = 0;
+    s_frees = 0;
+    s_isCounting = true;
+    logAll(iterations, longMessage);
+    s_isCounting = false;
+
+    fprintf(stderr, "%s: %ld iterations, %llu allocations, %llu frees\n",
+            name, iterations, s_allocations.load(), s_frees.load());
+    return (0 == s_allocations) && (0 == s_frees);
+}
+
+/**
+ * @brief Checks the allocations done while logging from worker threads
+ *
+ * Threads are started and warmed up before counting, and exit after.
+ *
+ * @param iterations number of iterations of each thread
+ * @param longMessage message longer than the record buffer of the thread
+ * @return true : no allocation
+ * @return false
+ */
+static bool checkWorkerAllocations(long iterations, const char *longMessage)
+{
+    std::atomic<int> ready(0);
+    std::atomic<int> done(0);
+    std::atomic<bool> start(false);
+    std::atomic<bool> finish(false);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < WORKER_COUNT; i++)
+    {
+        workers.push_back(std::thread([&] {
+            logAll(2000, longMessage);
+            ready++;
+            while (!start)
+                std::this_thread::yield();
+            logAll(iterations, longMessage);
+            done++;
+            while (!finish)
+                std::this_thread::yield();
+        }));
+    }
+
+    while (ready < WORKER_COUNT)
+        std::this_thread::yield();
+    s_allocations = 0;
+    s_frees = 0;
+    s_isCounting = true;
+    start = true;
+    while (done < WORKER_COUNT)
+        std::this_thread::yield();
+    s_isCounting = false;
+
+    finish = true;
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    fprintf(stderr, "%d workers: %ld iterations each, %llu allocations, %llu frees\n",
+            WORKER_COUNT, iterations, s_allocations.load(), s_frees.load());
+    return (0 == s_allocations) && (0 == s_frees);
+}
+
+int main(int argc, char const *argv[])
+{
+    long iterations = (argc > 1) ? atol(argv[1]) : 1000000;
+
+    // Message longer than the record buffer of the thread
+    static char longMessage[4096];
+    memset(longMessage, 'x', sizeof(longMessage) - 1);
+
+    // Storage of the Logger is checked for use after free
+    Logger::LogAllocator allocator = {checkAllocate, checkDeallocate, NULL};
+    Logger::setAllocator(allocator);
+
+    // Set the Logger Log Level
+    Logger::getInstance().setLogLevel(Logger::LOG_DEBUG);
+    // Set the Logger Stream
+    Logger::getInstance().setLogStream(Logger::STDOUT);
+
+    // Destroyed before the Logger, after the buffer of the main thread
+    static ExitLogger exitLogger;
+
+    // Console path (logs are not kept)
+    if (NULL == freopen("/dev/null", "w", stdout))
+        return 1;
+    bool isConsolePassed = checkAllocations("console", iterations, longMessage);
+
+    // File path
+    Logger::getInstance().setLogFile("zeroAllocLogger.log");
+    bool isFilePassed = checkAllocations("file", iterations, longMessage);
+
+    // File path, from worker threads
+    bool isWorkerPassed = checkWorkerAllocations(iterations / WORKER_COUNT, longMessage);
+
+    bool isPassed = isConsolePassed && isFilePassed && isWorkerPassed;
+    fprintf(stderr, "%s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? 0 : 1;
+}
+#else
+int main(int argc, char const *argv[])
+{
+    fprintf(stderr, "Allocation check needs glibc, skipped\n");
+    return 0;
+}
+#endif // __GLIBC__
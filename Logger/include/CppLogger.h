@@ -55,6 +55,96 @@ public:
         STDERR
     };
 
+    /**
+     * @brief Enum for Unix-domain Socket Type
+     */
+    enum LogSocketType
+    {
+        // For datagram socket (SOCK_DGRAM), one record per datagram
+        SOCKET_DATAGRAM,
+        // For stream socket (SOCK_STREAM), records are framed
+        SOCKET_STREAM
+    };
+
+    /**
+     * @brief Enum for Record Format on Socket
+     */
+    enum LogSocketFormat
+    {
+        // Same record format as console / file ([time]:[level] message)
+        SOCKET_FORMAT_PLAIN,
+        // RFC 5424 syslog format (for local syslog socket, e.g. /dev/log)
+        SOCKET_FORMAT_SYSLOG
+    };
+
+    /**
+     * @brief Enum for Durability of Log File
+     */
+    enum LogDurability
+    {
+        // No sync, logs reach the disk when the OS decides
+        DURABILITY_NONE,
+        // Logs are synced to disk periodically
+        DURABILITY_PERIODIC,
+        // Logs till the given Log Level are synced to disk before returning
+        DURABILITY_SYNC_ON_LEVEL
+    };
+
+    /**
+     * @brief Enum for Format of Binary Buffer Logs
+     */
+    enum LogHexFormat
+    {
+        // Continuous lowercase hex (e.g. 48656c6c6f)
+        HEX_PLAIN,
+        // Hexdump lines with offset, hex and ASCII
+        HEX_DUMP
+    };
+
+    /**
+     * @brief Allocator used for record buffers and queues
+     */
+    struct LogAllocator
+    {
+        // Allocates size bytes, returns NULL on failure
+        void *(*allocate)(size_t size, void *context);
+        // Frees memory returned by allocate
+        void (*deallocate)(void *ptr, size_t size, void *context);
+        // User context passed to allocate and deallocate
+        void *context;
+    };
+
+    /**
+     * @brief Hex encoded buffer, to be passed as "%s" argument in print format
+     *
+     * Example: debug("packet %s", Logger::HexBuffer(data, length).c_str());
+     */
+    class HexBuffer
+    {
+    public:
+        // Maximum number of bytes encoded, longer buffers are truncated with "..."
+        static const size_t MAX_BYTES = 256;
+
+        /**
+         * @brief Construct a new Hex Buffer object
+         *
+         * @param data binary buffer
+         * @param length number of bytes
+         */
+        HexBuffer(const void *data, size_t length);
+
+        /**
+         * @brief Get the Hex encoded string
+         *
+         * @return const char* : null terminated hex string
+         */
+        const char *c_str() const;
+
+    private:
+        // Hex encoded string (2 characters per byte, "..." and null)
+        char mText[2 * MAX_BYTES + 4];
+    };
+
     /**
      * @brief Destroy the Logger object
      */
@@ -81,6 +171,19 @@ public:
      */
     static unsigned char getMaxLogLevel();
 
+    /**
+     * @brief Set the Allocator used for record buffers and queues
+     *
+     * Logs use a buffer of each thread, allocation is done only for long
+     * logs (the storage is kept for the next logs) and for the socket sink
+     * (queue and its state). Must be called before logging, memory allocated
+     * earlier is freed with the allocator that allocated it. Memory must be
+     * aligned as by malloc.
+     * 
+     * @param allocator allocator (Logger::LogAllocator)
+     */
+    static void setAllocator(const LogAllocator &allocator);
+
     /**
      * @brief Set the Log Level for Logging
      * 
@@ -102,6 +205,57 @@ public:
      */
     void setLogFile(const char *filepath);
 
+    /**
+     * @brief Sends Logs to a Unix-domain socket instead of console print
+     *
+     * Records are queued in a bounded buffer and delivered in batches by a
+     * background thread, which also reconnects if the listener goes away.
+     * Records are dropped (and counted) when the buffer is full.
+     *
+     * @param socketPath path of the socket (NULL defaults to /dev/log)
+     * @param type socket type (Logger::LogSocketType)
+     * @param format record format (Logger::LogSocketFormat)
+     */
+    void setLogSocket(const char *socketPath, LogSocketType type, LogSocketFormat format);
+
+    /**
+     * @brief Get the Number of Logs dropped by the socket sink
+     *
+     * @return unsigned long long : Number of dropped Logs
+     */
+    unsigned long long getDroppedLogCount();
+
+    /**
+     * @brief Set the Durability of the Log File
+     *
+     * Concurrent logs waiting for durability share a single fdatasync.
+     * 
+     * @param durability durability mode (Logger::LogDurability)
+     * @param periodMs sync period in milliseconds (DURABILITY_PERIODIC)
+     * @param syncLevel least severe Log Level to sync (DURABILITY_SYNC_ON_LEVEL)
+     */
+    void setLogDurability(LogDurability durability, unsigned int periodMs, LogLevel syncLevel);
+
+    /**
+     * @brief Flush the Logs written so far
+     *
+     * For the socket sink, waits till the queued logs are sent, for at most 1 second.
+     * 
+     * @param durable if true, returns only when the logs are on disk (Log File)
+     * @return true 
+     * @return false : socket listener did not take the queued logs in time, or a sync
+     *                of the Log File failed (logs may be lost, stays false after that)
+     */
+    bool flush(bool durable);
+
+    /**
+     * @brief Set the Format of Binary Buffer Logs
+     * 
+     * @param format hex format (Logger::LogHexFormat)
+     * @param maxBytes maximum bytes logged per buffer, longer buffers are truncated (0 for no limit)
+     */
+    void setHexFormat(LogHexFormat format, size_t maxBytes);
+
     /**
      * @brief Logger for Fatal Logs
      * 
@@ -158,6 +312,69 @@ public:
      */
     void profile(const char *format, ...);
 
+    /**
+     * @brief Logger for Fatal Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void fatalHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Error Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void errorHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Warning Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void warningHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Information Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void infoHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Debug Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void debugHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Trace Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void traceHex(const char *label, const void *data, size_t length);
+
+    /**
+     * @brief Logger for Profile Binary Buffer Logs
+     * 
+     * @param label label printed before the buffer
+     * @param data binary buffer
+     * @param length number of bytes
+     */
+    void profileHex(const char *label, const void *data, size_t length);
+
 private:
     /**
      * @brief Construct a new Logger object
@@ -183,6 +400,18 @@ private:
 
     // Flag to Check setLogFile Called
     bool mIsSetLogFileInitalized;
+
+    // Flag to Check setLogSocket Called
+    bool mIsSetLogSocketInitalized;
+
+    // Flag to Check setLogDurability Called
+    bool mIsLogDurabilityInitalized;
+
+    // Format of Binary Buffer Logs
+    LogHexFormat mHexFormat;
+
+    // Maximum Bytes logged per Binary Buffer (0 for no limit)
+    size_t mHexMaxBytes;
 };
 
 #endif // __CPP_LOGGER_H__
\ No newline at end of file
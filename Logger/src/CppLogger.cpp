@@ -10,12 +10,19 @@
 #include <string>
 #include <cstring>
 #include <mutex>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <new>
 
 #if _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #include <stdint.h>
 #include <time.h>
+#include <io.h>
+#include <errno.h>
 
 #ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
 #define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
@@ -23,14 +30,101 @@
 
 #else
 #include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <errno.h>
 #endif // _WIN32
 
 // Logger Includes
 #include <CppLogger.h>
+#include "CppLoggerHex.h"
 
 // Mutex for logging
 static std::mutex s_logMutex;
 
+// Size of the record buffer of each thread, longer records use allocated storage
+#define LOG_RECORD_INLINE_SIZE  1024
+// Maximum size of the record header (color, time and level)
+#define LOG_RECORD_HEADER_SIZE  96
+
+#ifndef _WIN32
+// Number of records the socket sink can hold before dropping
+#define LOG_SOCKET_QUEUE_SIZE   1024
+// Maximum size of a single record sent on the socket
+#define LOG_SOCKET_RECORD_SIZE  2048
+// Maximum number of records sent in one system call
+#define LOG_SOCKET_BATCH_SIZE   64
+// Space reserved in front of a record for the stream frame header
+#define LOG_SOCKET_FRAME_SIZE   16
+// Reconnect backoff limits (in milliseconds)
+#define LOG_SOCKET_RETRY_MIN_MS 10
+#define LOG_SOCKET_RETRY_MAX_MS 1000
+// Send timeout so that the sender thread can notice shutdown
+#define LOG_SOCKET_SEND_TIMEOUT_MS 100
+// Time given to deliver the queued records on shutdown (in milliseconds)
+#define LOG_SOCKET_STOP_TIMEOUT_MS 1000
+// Time flush() waits for the queued records to be sent (in milliseconds)
+#define LOG_SOCKET_FLUSH_TIMEOUT_MS 1000
+// Maximum size of a log on the socket (time and level header included, null excluded)
+#define LOG_SOCKET_MESSAGE_SIZE (LOG_SOCKET_RECORD_SIZE - LOG_SOCKET_FRAME_SIZE - 1)
+
+/**
+ * @brief Bounded queue of records delivered to a Unix-domain socket
+ *        by a background sender thread
+ */
+struct LogSocketSink
+{
+    // Path of the socket
+    char path[sizeof(((sockaddr_un *)0)->sun_path)];
+    // Socket type
+    Logger::LogSocketType type;
+    // Record format
+    Logger::LogSocketFormat format;
+    // Connected socket (only used by the sender thread), -1 if not connected
+    int fd;
+    // Bytes of the head record already written (stream sockets)
+    size_t streamOffset;
+    // Record storage (LOG_SOCKET_QUEUE_SIZE * LOG_SOCKET_RECORD_SIZE)
+    char *records;
+    // Allocator of the record storage
+    Logger::LogAllocator allocator;
+    // Length of each record
+    size_t lengths[LOG_SOCKET_QUEUE_SIZE];
+    // Read and write counters (index = counter % LOG_SOCKET_QUEUE_SIZE)
+    size_t head;
+    size_t tail;
+    // Protects head, tail and stop
+    std::mutex mutex;
+    // Signals the sender thread
+    std::condition_variable cond;
+    // Signals flush() when the queue is empty
+    std::condition_variable drained;
+    // Flag to stop the sender thread
+    bool stop;
+    // Number of dropped records
+    std::atomic<unsigned long long> dropped;
+    // Host name for syslog records
+    char hostname[64];
+    // Sender thread
+    std::thread sender;
+};
+
+// Active socket sink (NULL if setLogSocket is not called or the sink is closed)
+static std::atomic<LogSocketSink *> s_socketSink(NULL);
+// Closed socket sink, kept for loggers which loaded it before it was closed
+static LogSocketSink *s_closedSocketSink = NULL;
+
+/**
+ * @brief Syslog severity for each Log Level (RFC 5424)
+ */
+const unsigned char syslogSeverity[Logger::LOG_MAX_LEVEL] = {
+            7, 2, 3, 4, 6, 7, 7, 7};
+
+// Syslog facility (user-level messages)
+#define LOG_SYSLOG_FACILITY 1
+#endif // _WIN32
+
 /**
  * @brief Color Codes for Different Log Levels
  */
@@ -46,30 +140,784 @@ const char colorCodes[Logger::LOG_MAX_LEVEL][10] = {
 /**
  * @brief Print Available Log Levels
  */
-void printAvaialbleLogs()
+void printAvaialbleLogs()
+{
+    printf("Available Values are: ");
+    for (unsigned char i = static_cast<unsigned char>(Logger::LogLevel::LOG_OFF);
+            i <= static_cast<unsigned char>(Logger::LogLevel::LOG_MAX_LEVEL) - 2; i++)
+    {
+        // Log Levels
+        printf("%d, ", i);
+    }
+    // Log Level for Profiling
+    printf("P\n");
+}
+
+/**
+ * @brief Function to allocate memory using malloc (default allocator)
+ * 
+ * @param size number of bytes
+ * @param context unused
+ * @return void* 
+ */
+void *allocateDefault(size_t size, void *context)
+{
+    (void)context;
+    return malloc(size);
+}
+
+/**
+ * @brief Function to free memory using free (default allocator)
+ * 
+ * @param ptr memory to free
+ * @param size unused
+ * @param context unused
+ */
+void deallocateDefault(void *ptr, size_t size, void *context)
+{
+    (void)size;
+    (void)context;
+    free(ptr);
+}
+
+// Allocator for record buffers and queues
+static Logger::LogAllocator s_allocator = {allocateDefault, deallocateDefault, NULL};
+
+/**
+ * @brief Record buffer of a thread, reused by every log of the thread
+ */
+struct LogRecordBuffer
+{
+    // Storage for usual records (no allocation)
+    char inlineData[LOG_RECORD_INLINE_SIZE];
+    // Current storage (inlineData, or allocated storage for long records)
+    char *data;
+    // Size of the current storage
+    size_t capacity;
+    // Allocator of the allocated storage
+    Logger::LogAllocator allocator;
+
+    LogRecordBuffer() : data(inlineData), capacity(LOG_RECORD_INLINE_SIZE), allocator(s_allocator) {}
+
+    ~LogRecordBuffer()
+    {
+        if (data != inlineData)
+            allocator.deallocate(data, capacity, allocator.context);
+
+        // Logs from static destructors run after the buffer of the main thread is destroyed,
+        // they must not use the freed storage (a long log allocates again, freed at exit)
+        data = inlineData;
+        capacity = LOG_RECORD_INLINE_SIZE;
+    }
+};
+
+// Record buffer of this thread
+static thread_local LogRecordBuffer s_recordBuffer;
+
+/**
+ * @brief Function to grow the record buffer (contents are not kept)
+ * 
+ * @param buffer record buffer
+ * @param size required size
+ * @return true 
+ * @return false : allocation failed, buffer is unchanged
+ */
+bool reserveLogRecord(LogRecordBuffer *buffer, size_t size)
+{
+    if (size <= buffer->capacity)
+        return true;
+
+    // Grow geometrically, so that growth stops after warm-up
+    size_t capacity = buffer->capacity * 2;
+    while (capacity < size)
+        capacity *= 2;
+
+    Logger::LogAllocator allocator = s_allocator;
+    char *data = static_cast<char *>(allocator.allocate(capacity, allocator.context));
+    if (NULL == data)
+        return false;
+
+    if (buffer->data != buffer->inlineData)
+        buffer->allocator.deallocate(buffer->data, buffer->capacity, buffer->allocator.context);
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+    buffer->allocator = allocator;
+    return true;
+}
+
+#ifndef _WIN32
+/**
+ * @brief Function to connect the socket sink to its listener
+ * 
+ * @param sink socket sink
+ * @return true 
+ * @return false 
+ */
+bool connectLogSocket(LogSocketSink *sink)
+{
+    int type = (Logger::LogSocketType::SOCKET_STREAM == sink->type) ? SOCK_STREAM : SOCK_DGRAM;
+    int fd = socket(AF_UNIX, type, 0);
+    if (fd < 0)
+        return false;
+
+    // Bound the time a send can block, so shutdown is not held up by a slow listener
+    timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = LOG_SOCKET_SEND_TIMEOUT_MS * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, sink->path, sizeof(addr.sun_path) - 1);
+
+    if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    sink->fd = fd;
+    sink->streamOffset = 0;
+    return true;
+}
+
+/**
+ * @brief Function to close the socket of the sink after a send failure
+ * 
+ * @param sink socket sink
+ */
+void disconnectLogSocket(LogSocketSink *sink)
+{
+    close(sink->fd);
+    sink->fd = -1;
+    // Partially written record is lost with the connection, resend it fully
+    sink->streamOffset = 0;
+}
+
+/**
+ * @brief Function to send a batch of queued records on the socket
+ * 
+ * @param sink socket sink
+ * @param head counter of the first record to send
+ * @param count number of records to send
+ * @return size_t : number of records completely sent
+ */
+size_t sendLogSocketRecords(LogSocketSink *sink, size_t head, size_t count)
+{
+    iovec iov[LOG_SOCKET_BATCH_SIZE];
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t index = (head + i) % LOG_SOCKET_QUEUE_SIZE;
+        iov[i].iov_base = sink->records + (index * LOG_SOCKET_RECORD_SIZE);
+        iov[i].iov_len = sink->lengths[index];
+    }
+
+    if (Logger::LogSocketType::SOCKET_STREAM == sink->type)
+    {
+        // Gather all records into a single write
+        iov[0].iov_base = static_cast<char *>(iov[0].iov_base) + sink->streamOffset;
+        iov[0].iov_len -= sink->streamOffset;
+
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count;
+
+        ssize_t written = sendmsg(sink->fd, &msg, MSG_NOSIGNAL);
+        if (written < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                disconnectLogSocket(sink);
+            return 0;
+        }
+
+        // Count the records which are completely written
+        size_t remaining = static_cast<size_t>(written);
+        size_t sent = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (remaining < iov[i].iov_len)
+            {
+                sink->streamOffset = (i == 0 ? sink->streamOffset : 0) + remaining;
+                break;
+            }
+            remaining -= iov[i].iov_len;
+            sink->streamOffset = 0;
+            sent++;
+        }
+        return sent;
+    }
+
+#ifdef __linux__
+    // One datagram per record, all in a single system call
+    mmsghdr msgs[LOG_SOCKET_BATCH_SIZE];
+    memset(msgs, 0, sizeof(mmsghdr) * count);
+    for (size_t i = 0; i < count; i++)
+    {
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int sent = sendmmsg(sink->fd, msgs, static_cast<unsigned int>(count), MSG_NOSIGNAL);
+#else
+    int sent = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov[i];
+        msg.msg_iovlen = 1;
+        if (sendmsg(sink->fd, &msg, MSG_NOSIGNAL) < 0)
+        {
+            if (sent == 0)
+                sent = -1;
+            break;
+        }
+        sent++;
+    }
+#endif // __linux__
+    if (sent < 0)
+    {
+        if (errno == EMSGSIZE)
+        {
+            // Record can never be delivered, drop it
+            sink->dropped++;
+            return 1;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            disconnectLogSocket(sink);
+        return 0;
+    }
+    return static_cast<size_t>(sent);
+}
+
+/**
+ * @brief Sender thread of the socket sink
+ * 
+ * @param sink socket sink
+ */
+void runLogSocket(LogSocketSink *sink)
+{
+    unsigned int retryMs = LOG_SOCKET_RETRY_MIN_MS;
+    bool isStopping = false;
+    std::chrono::steady_clock::time_point stopDeadline;
+
+    std::unique_lock<std::mutex> lock(sink->mutex);
+    while (true)
+    {
+        sink->cond.wait(lock, [sink] { return sink->stop || (sink->head != sink->tail); });
+
+        // Stopped and everything is delivered
+        if (sink->head == sink->tail)
+            break;
+
+        // Bound the time spent delivering on shutdown, a listener may never read
+        if (sink->stop && !isStopping)
+        {
+            isStopping = true;
+            stopDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOG_SOCKET_STOP_TIMEOUT_MS);
+        }
+
+        if (sink->fd < 0)
+        {
+            lock.unlock();
+            bool isConnected = connectLogSocket(sink);
+            lock.lock();
+
+            if (!isConnected)
+            {
+                // Stopped and listener is not available, remaining records are lost
+                if (sink->stop)
+                {
+                    sink->dropped += (sink->tail - sink->head);
+                    sink->head = sink->tail;
+                    break;
+                }
+
+                // Retry later, callers keep queueing (or dropping) meanwhile
+                sink->cond.wait_for(lock, std::chrono::milliseconds(retryMs), [sink] { return sink->stop; });
+                retryMs = (retryMs * 2 > LOG_SOCKET_RETRY_MAX_MS) ? LOG_SOCKET_RETRY_MAX_MS : retryMs * 2;
+                continue;
+            }
+            retryMs = LOG_SOCKET_RETRY_MIN_MS;
+        }
+
+        // Records in [head, tail) are not touched by callers, send them without the lock
+        size_t head = sink->head;
+        size_t count = sink->tail - sink->head;
+        if (count > LOG_SOCKET_BATCH_SIZE)
+            count = LOG_SOCKET_BATCH_SIZE;
+
+        lock.unlock();
+        size_t sent = sendLogSocketRecords(sink, head, count);
+        lock.lock();
+
+        sink->head += sent;
+
+        if (sink->head == sink->tail)
+            sink->drained.notify_all();
+
+        // Stopped and the listener is not reading (or too slow), remaining records are lost
+        if (isStopping && (sink->head != sink->tail) &&
+            ((0 == sent) || (std::chrono::steady_clock::now() >= stopDeadline)))
+        {
+            sink->dropped += (sink->tail - sink->head);
+            sink->head = sink->tail;
+            break;
+        }
+    }
+
+    // Release flush() callers, the queue is either delivered or dropped
+    sink->drained.notify_all();
+
+    if (sink->fd >= 0)
+        disconnectLogSocket(sink);
+}
+
+/**
+ * @brief Function to format the header of a socket record (syslog or plain)
+ * 
+ * @param sink socket sink
+ * @param level Log Level of the record
+ * @param logLevelName name of the log level
+ * @param body record body (LOG_SOCKET_MESSAGE_SIZE + 1 characters)
+ * @return int : length of the header, -1 on error
+ */
+int formatLogSocketHeader(LogSocketSink *sink, Logger::LogLevel level, const char *logLevelName, char *body)
+{
+    const size_t maxLength = LOG_SOCKET_MESSAGE_SIZE + 1;
+    int length = 0;
+
+    timeval currTime;
+    gettimeofday(&currTime, NULL);
+    time_t seconds = currTime.tv_sec;
+
+    if (Logger::LogSocketFormat::SOCKET_FORMAT_SYSLOG == sink->format)
+    {
+        // <PRI>VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA MSG
+#ifdef __GLIBC__
+        const char *appName = program_invocation_short_name;
+#else
+        const char *appName = "-";
+#endif // __GLIBC__
+        struct tm tm;
+        gmtime_r(&seconds, &tm);
+        length = snprintf(body, maxLength, "<%d>1 %d-%02d-%02dT%02d:%02d:%02d.%06dZ %s %s %d %s - ",
+                          LOG_SYSLOG_FACILITY * 8 + syslogSeverity[static_cast<unsigned char>(level)],
+                          tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                          tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(currTime.tv_usec),
+                          sink->hostname, appName, static_cast<int>(getpid()), logLevelName);
+    }
+    else
+    {
+        struct tm tm;
+        localtime_r(&seconds, &tm);
+        length = snprintf(body, maxLength, "[%d-%02d-%02d %02d:%02d:%02d:%06d]:[%s] ",
+                          tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                          tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(currTime.tv_usec),
+                          logLevelName);
+    }
+    if (length >= 0 && static_cast<size_t>(length) >= maxLength)
+        length = static_cast<int>(maxLength) - 1;
+    return length;
+}
+
+/**
+ * @brief Function to frame a record and push it on the socket sink queue (never blocks on the socket)
+ * 
+ * @param sink socket sink
+ * @param body record body, with LOG_SOCKET_FRAME_SIZE characters free before it
+ * @param length length of the body (at most LOG_SOCKET_MESSAGE_SIZE)
+ */
+void pushLogSocketRecord(LogSocketSink *sink, char *body, int length)
+{
+    char *start = body;
+    if (Logger::LogSocketType::SOCKET_STREAM == sink->type)
+    {
+        if (Logger::LogSocketFormat::SOCKET_FORMAT_SYSLOG == sink->format)
+        {
+            // Octet counting framing (RFC 6587): "LENGTH SP MSG"
+            char frame[LOG_SOCKET_FRAME_SIZE];
+            int frameLength = snprintf(frame, sizeof(frame), "%d ", length);
+            start = body - frameLength;
+            memcpy(start, frame, frameLength);
+            length += frameLength;
+        }
+        else
+        {
+            // Newline framing, replaces the terminating null
+            body[length++] = '\n';
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    if (sink->stop || (sink->tail - sink->head >= LOG_SOCKET_QUEUE_SIZE))
+    {
+        // Sink is closed, or listener is slow or not available
+        sink->dropped++;
+        return;
+    }
+
+    size_t index = sink->tail % LOG_SOCKET_QUEUE_SIZE;
+    memcpy(sink->records + (index * LOG_SOCKET_RECORD_SIZE), start, length);
+    sink->lengths[index] = static_cast<size_t>(length);
+
+    // Wake up the sender thread only if it might be waiting for records
+    bool wasEmpty = (sink->head == sink->tail);
+    sink->tail++;
+    if (wasEmpty)
+        sink->cond.notify_one();
+}
+
+/**
+ * @brief Function to queue a record on the socket sink (never blocks on the socket)
+ * 
+ * @param sink socket sink
+ * @param level Log Level of the record
+ * @param logLevelName name of the log level
+ * @param format print format
+ * @param args print arguments
+ */
+void queueLogSocketRecord(LogSocketSink *sink, Logger::LogLevel level, const char *logLevelName,
+                          const char *format, va_list args)
+{
+    char record[LOG_SOCKET_FRAME_SIZE + LOG_SOCKET_RECORD_SIZE];
+    char *body = record + LOG_SOCKET_FRAME_SIZE;
+    const size_t maxLength = LOG_SOCKET_MESSAGE_SIZE + 1;
+
+    int length = formatLogSocketHeader(sink, level, logLevelName, body);
+    if (length < 0)
+        return;
+
+    int messageLength = vsnprintf(body + length, maxLength - length, format, args);
+    if (messageLength > 0)
+    {
+        // Truncate long records
+        length += messageLength;
+        if (static_cast<size_t>(length) >= maxLength)
+            length = static_cast<int>(maxLength) - 1;
+    }
+
+    pushLogSocketRecord(sink, body, length);
+}
+
+/**
+ * @brief Function to queue a binary buffer record on the socket sink, hex encoded in the record
+ * 
+ * The buffer is cut to the space left in the record, and marked with "...".
+ * Hexdump lines are sent as plain hex on newline framed sockets (stream, plain format),
+ * else the agent would take each line for a record.
+ * 
+ * @param sink socket sink
+ * @param level Log Level of the record
+ * @param logLevelName name of the log level
+ * @param label label printed before the buffer
+ * @param bytes binary buffer
+ * @param length number of bytes
+ * @param maxBytes maximum bytes to encode (0 for no limit)
+ * @param isHexDump true for hexdump lines, false for plain hex
+ */
+void queueLogSocketHex(LogSocketSink *sink, Logger::LogLevel level, const char *logLevelName, const char *label,
+                       const unsigned char *bytes, size_t length, size_t maxBytes, bool isHexDump)
+{
+    char record[LOG_SOCKET_FRAME_SIZE + LOG_SOCKET_RECORD_SIZE];
+    char *body = record + LOG_SOCKET_FRAME_SIZE;
+    const size_t maxLength = LOG_SOCKET_MESSAGE_SIZE + 1;
+
+    int recordLength = formatLogSocketHeader(sink, level, logLevelName, body);
+    if (recordLength < 0)
+        return;
+
+    if ((Logger::LogSocketType::SOCKET_STREAM == sink->type) &&
+        (Logger::LogSocketFormat::SOCKET_FORMAT_PLAIN == sink->format))
+    {
+        isHexDump = false;
+    }
+
+    int labelLength = snprintf(body + recordLength, maxLength - recordLength, "%s [%zu bytes]:%s",
+                               label, length, isHexDump ? "\n" : " ");
+    if (labelLength > 0)
+    {
+        recordLength += labelLength;
+        if (static_cast<size_t>(recordLength) >= maxLength)
+            recordLength = static_cast<int>(maxLength) - 1;
+    }
+
+    // Encode straight into the record, only what fits
+    recordLength += static_cast<int>(encodeHexText(body + recordLength, LOG_SOCKET_MESSAGE_SIZE - recordLength,
+                                                   bytes, length, maxBytes, isHexDump));
+    pushLogSocketRecord(sink, body, recordLength);
+}
+
+/**
+ * @brief Function to initalize the socket sink and start the sender thread
+ * 
+ * @param socketPath path of the socket
+ * @param type socket type
+ * @param format record format
+ * @return true 
+ * @return false 
+ */
+bool initalizeLogSocket(const char *socketPath, Logger::LogSocketType type, Logger::LogSocketFormat format)
+{
+    if (strlen(socketPath) >= sizeof(LogSocketSink::path))
+    {
+        printf("Socket path %s is too long\n", socketPath);
+        return false;
+    }
+
+    // Sink (with the record lengths) and record slots are allocated once with the Logger allocator
+    Logger::LogAllocator allocator = s_allocator;
+    void *memory = allocator.allocate(sizeof(LogSocketSink), allocator.context);
+    if (NULL == memory)
+    {
+        printf("Failed to allocate Log Socket\n");
+        return false;
+    }
+    LogSocketSink *sink = new (memory) LogSocketSink();
+
+    strcpy(sink->path, socketPath);
+    sink->type = type;
+    sink->format = format;
+    sink->fd = -1;
+    sink->streamOffset = 0;
+    // Record slots are reused, no allocation per record
+    sink->allocator = allocator;
+    sink->records = static_cast<char *>(allocator.allocate(LOG_SOCKET_QUEUE_SIZE * LOG_SOCKET_RECORD_SIZE,
+                                                           allocator.context));
+    if (NULL == sink->records)
+    {
+        printf("Failed to allocate Log Socket queue\n");
+        sink->~LogSocketSink();
+        allocator.deallocate(memory, sizeof(LogSocketSink), allocator.context);
+        return false;
+    }
+    sink->head = 0;
+    sink->tail = 0;
+    sink->stop = false;
+    sink->dropped = 0;
+    if (gethostname(sink->hostname, sizeof(sink->hostname)) != 0)
+        strcpy(sink->hostname, "-");
+    sink->hostname[sizeof(sink->hostname) - 1] = '\0';
+
+    // Connection is done by the sender thread, so a missing listener does not block here
+    sink->sender = std::thread(runLogSocket, sink);
+
+    s_socketSink = sink;
+    return true;
+}
+
+/**
+ * @brief Function to wait until the records queued so far are sent (or dropped)
+ * 
+ * @param sink socket sink
+ * @return true 
+ * @return false : records are still queued after LOG_SOCKET_FLUSH_TIMEOUT_MS
+ */
+bool flushLogSocket(LogSocketSink *sink)
+{
+    std::unique_lock<std::mutex> lock(sink->mutex);
+    const size_t target = sink->tail;
+
+    // Bounded wait, a listener may never read
+    return sink->drained.wait_for(lock, std::chrono::milliseconds(LOG_SOCKET_FLUSH_TIMEOUT_MS),
+                                  [sink, target] { return sink->stop || (sink->head >= target); });
+}
+
+/**
+ * @brief Function to deliver the queued records and stop the socket sink
+ *
+ * The sink itself is not freed: a thread which is still logging may hold it,
+ * logs from such threads are counted as dropped.
+ */
+void closeLogSocket()
+{
+    LogSocketSink *sink = s_socketSink.exchange(NULL);
+    if (NULL == sink)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(sink->mutex);
+        sink->stop = true;
+    }
+    sink->cond.notify_one();
+    sink->sender.join();
+
+    // Records are not touched once stopped, only the sink (mutex and counters) is kept
+    std::lock_guard<std::mutex> lock(sink->mutex);
+    sink->allocator.deallocate(sink->records, LOG_SOCKET_QUEUE_SIZE * LOG_SOCKET_RECORD_SIZE, sink->allocator.context);
+    sink->records = NULL;
+    s_closedSocketSink = sink;
+}
+#endif // _WIN32
+
+/**
+ * @brief Durability state of the log file
+ */
+struct LogFileDurability
+{
+    // Durability mode
+    Logger::LogDurability mode;
+    // Least severe Log Level synced on write (DURABILITY_SYNC_ON_LEVEL)
+    Logger::LogLevel syncLevel;
+    // Sync period in milliseconds (DURABILITY_PERIODIC)
+    unsigned int periodMs;
+    // Log file (stdout or stderr redirected to file), NULL if not set
+    FILE *file;
+    // Number of records written to the file (protected by s_logMutex)
+    unsigned long long written;
+    // Number of records known to be on disk (protected by mutex)
+    unsigned long long synced;
+    // Last record of a failed sync, 0 if none (protected by mutex)
+    // Records upto it may be lost, a later sync can succeed without writing them
+    unsigned long long lost;
+    // Flag to check a sync is in progress (protected by mutex)
+    bool isSyncing;
+    // Flag to stop the periodic sync thread (protected by mutex)
+    bool stop;
+    // Protects synced, isSyncing and stop
+    std::mutex mutex;
+    // Signals the end of a sync and the stop of periodic thread
+    std::condition_variable cond;
+    // Periodic sync thread
+    std::thread periodic;
+};
+
+// Durability state of the log file
+static LogFileDurability s_fileDurability;
+
+/**
+ * @brief Function to sync the data of the file to disk
+ * 
+ * @param file file to sync
+ * @return int : 0 on success, else error number (e.g. EIO, ENOSPC)
+ */
+int syncFileData(FILE *file)
+{
+#ifdef _WIN32
+    int result = _commit(_fileno(file));
+#elif defined(__APPLE__)
+    int result = fsync(fileno(file));
+#else
+    int result = fdatasync(fileno(file));
+#endif // _WIN32
+    return (0 == result) ? 0 : errno;
+}
+
+/**
+ * @brief Function to make the records written to the log file durable
+ *
+ * Uses group commit: callers arriving while a sync is in progress wait for
+ * it, and the next sync covers all of them with a single fdatasync.
+ *
+ * A failed sync is not retried for the records it covered (the kernel may
+ * have dropped them, and report the next sync as success), they stay lost.
+ * 
+ * @param durability durability state of the log file
+ * @param record number of records which must be on disk
+ * @return true : all records upto record are on disk
+ * @return false : a sync failed, some records may not be on disk
+ */
+bool syncLogFile(LogFileDurability *durability, unsigned long long record)
+{
+    std::unique_lock<std::mutex> lock(durability->mutex);
+    while (durability->synced < record)
+    {
+        if (durability->isSyncing)
+        {
+            // Another caller is syncing, check again once it is done
+            durability->cond.wait(lock);
+            if (durability->lost >= record)
+                break;
+            continue;
+        }
+        durability->isSyncing = true;
+        lock.unlock();
+
+        // Move everything written so far from stdio to the kernel, then to disk
+        unsigned long long target;
+        int error = 0;
+        {
+            std::lock_guard<std::mutex> logLock(s_logMutex);
+            target = durability->written;
+            if (fflush(durability->file) != 0)
+                error = errno;
+        }
+        if (0 == error)
+            error = syncFileData(durability->file);
+
+        lock.lock();
+        durability->isSyncing = false;
+        if (0 != error)
+        {
+            if (target > durability->lost)
+                durability->lost = target;
+        }
+        else if (target > durability->synced)
+        {
+            durability->synced = target;
+        }
+        durability->cond.notify_all();
+        if (0 != error)
+            break;
+    }
+    return 0 == durability->lost;
+}
+
+/**
+ * @brief Periodic sync thread of the log file
+ * 
+ * @param durability durability state of the log file
+ */
+void runLogFileSync(LogFileDurability *durability)
+{
+    std::unique_lock<std::mutex> lock(durability->mutex);
+    while (!durability->stop)
+    {
+        durability->cond.wait_for(lock, std::chrono::milliseconds(durability->periodMs),
+                                  [durability] { return durability->stop; });
+        lock.unlock();
+
+        unsigned long long record;
+        {
+            std::lock_guard<std::mutex> logLock(s_logMutex);
+            record = durability->written;
+        }
+        syncLogFile(durability, record);
+
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Function to stop the periodic sync thread of the log file
+ * 
+ * @param durability durability state of the log file
+ */
+void stopLogFileSync(LogFileDurability *durability)
 {
-    printf("Available Values are: ");
-    for (unsigned char i = static_cast<unsigned char>(Logger::LogLevel::LOG_OFF);
-            i <= static_cast<unsigned char>(Logger::LogLevel::LOG_MAX_LEVEL) - 2; i++)
+    if (!durability->periodic.joinable())
+        return;
+
     {
-        // Log Levels
-        printf("%d, ", i);
+        std::lock_guard<std::mutex> lock(durability->mutex);
+        durability->stop = true;
     }
-    // Log Level for Profiling
-    printf("P\n");
+    durability->cond.notify_all();
+    durability->periodic.join();
 }
 
 /**
- * @brief Function to Print log on Console
+ * @brief Function to format the header of a record (time and level), with color code for console
  * 
- * @param stream Stream type (stdout or stderr) [Logger::LogStream]
+ * @param header header buffer (LOG_RECORD_HEADER_SIZE characters)
  * @param logLevelName name of the log level
  * @param colorCode color code for the log level
- * @param format print format
- * @param args print arguments
+ * @param isSavingToFile flag to check logs are saved to file
+ * @return size_t : length of the header
  */
-void printLog(Logger::LogStream stream, const char *logLevelName, const char *colorCode,
-              const char *format, va_list args, bool isSavingToFile)
+size_t formatLogHeader(char *header, const char *logLevelName, const char *colorCode, bool isSavingToFile)
 {
     char dateTime[40];
 #ifdef _WIN32
@@ -85,58 +933,185 @@ void printLog(Logger::LogStream stream, const char *logLevelName, const char *co
     // Get time
     gettimeofday(&currTime, NULL);
 
-    struct tm tm = *localtime(reinterpret_cast<time_t *>(&currTime.tv_sec));
+    // localtime_r does not reload the time zone on every call (localtime does, allocating)
+    struct tm tm;
+    time_t seconds = currTime.tv_sec;
+    localtime_r(&seconds, &tm);
     sprintf(dateTime, "%d-%02d-%02d %02d:%02d:%02d:%06d",
             tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
             tm.tm_hour, tm.tm_min, tm.tm_sec, currTime.tv_usec);
 #endif // _WIN32
 
-    if (Logger::LogStream::STDOUT == stream)
+    int headerLength = isSavingToFile ?
+                           snprintf(header, LOG_RECORD_HEADER_SIZE, "[%s]:[%s] ", dateTime, logLevelName) :
+                           snprintf(header, LOG_RECORD_HEADER_SIZE, "%s[%s]:[%s] ", colorCode, dateTime, logLevelName);
+    if (headerLength < 0)
+        return 0;
+    if (headerLength >= LOG_RECORD_HEADER_SIZE)
+        return LOG_RECORD_HEADER_SIZE - 1;
+    return static_cast<size_t>(headerLength);
+}
+
+/**
+ * @brief Function to write a formatted record to the stream (single write)
+ * 
+ * @param stream Stream type (stdout or stderr) [Logger::LogStream]
+ * @param level Log Level of the log
+ * @param data record
+ * @param length length of the record
+ * @param isSavingToFile flag to check logs are saved to file
+ */
+void writeLogRecord(Logger::LogStream stream, Logger::LogLevel level, const char *data, size_t length,
+                    bool isSavingToFile)
+{
+    // Number of this record in the log file
+    unsigned long long record = 0;
+
+    FILE *file = (Logger::LogStream::STDERR == stream) ? stderr : stdout;
     {
-        // Output Stream in stdout
-        if (isSavingToFile)
-        {
-            // To avoid interleved messages
-            std::lock_guard<std::mutex> lock(s_logMutex);
+        // To avoid interleved messages
+        std::lock_guard<std::mutex> lock(s_logMutex);
 
-            // Remove the color codes from the string
-            fprintf(stdout, "[%s]:[%s] ", dateTime, logLevelName);
-            vfprintf(stdout, format, args);
-            vfprintf(stdout, "\n", args);
-        }
-        else
-        {
-            // To avoid interleved messages
-            std::lock_guard<std::mutex> lock(s_logMutex);
+        fwrite(data, 1, length, file);
+        if (isSavingToFile)
+            record = ++s_fileDurability.written;
+    }
 
-            fprintf(stdout, "%s[%s]:[%s] ", colorCode, dateTime, logLevelName);
-            vfprintf(stdout, format, args);
-            vfprintf(stdout, "\033[1;0m\n", args);
-        }
+    // Make the record durable before returning, for the configured Log Levels
+    if (record > 0 && (Logger::LogDurability::DURABILITY_SYNC_ON_LEVEL == s_fileDurability.mode) &&
+        (level <= s_fileDurability.syncLevel))
+    {
+        syncLogFile(&s_fileDurability, record);
     }
-    else if (Logger::LogStream::STDERR == stream)
+}
+
+/**
+ * @brief Function to Print log on Console
+ * 
+ * @param stream Stream type (stdout or stderr) [Logger::LogStream]
+ * @param level Log Level of the log
+ * @param logLevelName name of the log level
+ * @param colorCode color code for the log level
+ * @param format print format
+ * @param args print arguments
+ */
+void printLog(Logger::LogStream stream, Logger::LogLevel level, const char *logLevelName, const char *colorCode,
+              const char *format, va_list args, bool isSavingToFile)
+{
+#ifndef _WIN32
+    // Logs are sent to the socket instead of the console / file
+    LogSocketSink *sink = s_socketSink;
+    if (NULL != sink)
     {
-        // Output Stream in stderr
-        if (isSavingToFile)
-        {
-            // To avoid interleved messages
-            std::lock_guard<std::mutex> lock(s_logMutex);
+        queueLogSocketRecord(sink, level, logLevelName, format, args);
+        return;
+    }
+#endif // _WIN32
 
-            // Remove the color codes from the string
-            fprintf(stderr, "[%s]:[%s] ", dateTime, logLevelName);
-            vfprintf(stderr, format, args);
-            vfprintf(stderr, "\n", args);
-        }
+    char header[LOG_RECORD_HEADER_SIZE];
+    size_t headerLength = formatLogHeader(header, logLevelName, colorCode, isSavingToFile);
+
+    // Trailer (reset color code for console)
+    const char *trailer = isSavingToFile ? "\n" : "\033[1;0m\n";
+    const size_t trailerLength = strlen(trailer);
+
+    // Format the record in the buffer of this thread, so the stream is written once
+    LogRecordBuffer &buffer = s_recordBuffer;
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int messageLength = vsnprintf(buffer.data + headerLength, buffer.capacity - headerLength - trailerLength,
+                                  format, args);
+    if (messageLength < 0)
+        messageLength = 0;
+
+    size_t recordLength = headerLength + messageLength + trailerLength;
+    if (recordLength >= buffer.capacity)
+    {
+        // Long message, grow the buffer (kept for the next logs of this thread) or truncate
+        if (reserveLogRecord(&buffer, recordLength + 1))
+            vsnprintf(buffer.data + headerLength, buffer.capacity - headerLength - trailerLength, format, argsCopy);
         else
-        {
-            // To avoid interleved messages
-            std::lock_guard<std::mutex> lock(s_logMutex);
+            recordLength = buffer.capacity - 1;
+    }
+    va_end(argsCopy);
 
-            fprintf(stderr, "%s[%s]:[%s] ", colorCode, dateTime, logLevelName);
-            vfprintf(stderr, format, args);
-            vfprintf(stderr, "\033[1;0m\n", args);
-        }
+    memcpy(buffer.data, header, headerLength);
+    memcpy(buffer.data + recordLength - trailerLength, trailer, trailerLength);
+
+    writeLogRecord(stream, level, buffer.data, recordLength, isSavingToFile);
+}
+
+/**
+ * @brief Function to Print binary buffer log (hex encoded in the record buffer of the thread)
+ * 
+ * @param stream Stream type (stdout or stderr) [Logger::LogStream]
+ * @param level Log Level of the log
+ * @param logLevelName name of the log level
+ * @param colorCode color code for the log level
+ * @param hexFormat format of the buffer
+ * @param maxBytes maximum bytes to print (0 for no limit)
+ * @param label label printed before the buffer
+ * @param data binary buffer
+ * @param length number of bytes
+ * @param isSavingToFile flag to check logs are saved to file
+ */
+void printHexLog(Logger::LogStream stream, Logger::LogLevel level, const char *logLevelName, const char *colorCode,
+                 Logger::LogHexFormat hexFormat, size_t maxBytes, const char *label, const void *data, size_t length,
+                 bool isSavingToFile)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    bool isHexDump = (Logger::LogHexFormat::HEX_DUMP == hexFormat) && (length > 0);
+    if (NULL == label)
+        label = "";
+
+#ifndef _WIN32
+    // Logs are sent to the socket instead of the console / file
+    LogSocketSink *sink = s_socketSink;
+    if (NULL != sink)
+    {
+        queueLogSocketHex(sink, level, logLevelName, label, bytes, length, maxBytes, isHexDump);
+        return;
     }
+#endif // _WIN32
+
+    char header[LOG_RECORD_HEADER_SIZE];
+    size_t headerLength = formatLogHeader(header, logLevelName, colorCode, isSavingToFile);
+
+    // Size of the buffer, for the label
+    char sizeText[40];
+    int sizeLength = snprintf(sizeText, sizeof(sizeText), " [%zu bytes]:%s", length, isHexDump ? "\n" : " ");
+    if (sizeLength < 0)
+        sizeLength = 0;
+    size_t labelLength = strlen(label);
+
+    // Trailer (reset color code for console)
+    const char *trailer = isSavingToFile ? "\n" : "\033[1;0m\n";
+    const size_t trailerLength = strlen(trailer);
+
+    // Grow the buffer of this thread for the whole record (kept for the next logs), or cut the buffer
+    size_t encodeLength = (maxBytes != 0 && length > maxBytes) ? maxBytes : length;
+    size_t textSize = (isHexDump ? hexDumpSize(encodeLength) : 2 * encodeLength) + 3;
+    LogRecordBuffer &buffer = s_recordBuffer;
+    reserveLogRecord(&buffer, headerLength + labelLength + sizeLength + textSize + trailerLength + 1);
+
+    // Record is written in place: header, label, hex and trailer
+    size_t available = buffer.capacity - trailerLength - 1;
+    size_t recordLength = headerLength;
+    memcpy(buffer.data, header, headerLength);
+    if (labelLength > available - recordLength)
+        labelLength = available - recordLength;
+    memcpy(buffer.data + recordLength, label, labelLength);
+    recordLength += labelLength;
+    if (static_cast<size_t>(sizeLength) > available - recordLength)
+        sizeLength = static_cast<int>(available - recordLength);
+    memcpy(buffer.data + recordLength, sizeText, sizeLength);
+    recordLength += sizeLength;
+    recordLength += encodeHexText(buffer.data + recordLength, available - recordLength, bytes, length, maxBytes,
+                                  isHexDump);
+    memcpy(buffer.data + recordLength, trailer, trailerLength);
+    recordLength += trailerLength;
+
+    writeLogRecord(stream, level, buffer.data, recordLength, isSavingToFile);
 }
 
 /**
@@ -180,6 +1155,17 @@ bool initalizeLogFile(Logger::LogStream stream, const char *filepath)
 
 Logger::~Logger()
 {
+#ifndef _WIN32
+    if (mIsSetLogSocketInitalized)
+    {
+        // Deliver the pending logs and stop the sender thread
+        closeLogSocket();
+    }
+#endif // _WIN32
+
+    // Stop the periodic sync before closing the file
+    stopLogFileSync(&s_fileDurability);
+
     if (mIsSetLogFileInitalized)
     {
         // Close the file
@@ -386,6 +1372,154 @@ void Logger::setLogFile(const char *filepath)
     return;
 }
 
+void Logger::setLogSocket(const char *socketPath, LogSocketType type, LogSocketFormat format)
+{
+    // Return if already initalized
+    if (mIsSetLogSocketInitalized)
+        return;
+
+#ifdef _WIN32
+    printf("Log Socket is Not Implemented for Windows\n");
+#else
+    // Read the Environment Variable
+    const char *envName = "LOG_SOCKET";
+    const char *envVarData = std::getenv(envName);
+
+    if (NULL == envVarData)
+    {
+        printf("Environment Variable \"%s\" is not available\n", envName);
+
+        // Check if the socketPath passed is null
+        if (NULL == socketPath)
+        {
+            // Defaulting to local syslog socket
+            printf("Found NULL in socketPath, Defaulting to /dev/log\n");
+            socketPath = "/dev/log";
+        }
+    }
+    else
+    {
+        // Send to the Environment variable socket
+        printf("Environment Variable \"%s\" is set to %s\n", envName, envVarData);
+        socketPath = envVarData;
+    }
+
+    printf("Sending Logs to socket (%s)\n", socketPath);
+    mIsSetLogSocketInitalized = initalizeLogSocket(socketPath, type, format);
+#endif // _WIN32
+
+    return;
+}
+
+unsigned long long Logger::getDroppedLogCount()
+{
+#ifndef _WIN32
+    LogSocketSink *sink = s_socketSink;
+    if (NULL != sink)
+        return sink->dropped;
+#endif // _WIN32
+    return 0;
+}
+
+void Logger::setLogDurability(LogDurability durability, unsigned int periodMs, LogLevel syncLevel)
+{
+    // Function Needs to be called after setLogFile()
+    // Reason: Durability is applied to the log file
+    if (!mIsSetLogFileInitalized)
+    {
+        printf("Please call the function setLogDurability() after setLogFile()\n");
+        return;
+    }
+
+    // Return if already initalized
+    if (mIsLogDurabilityInitalized)
+        return;
+
+    s_fileDurability.mode = durability;
+    s_fileDurability.syncLevel = syncLevel;
+    s_fileDurability.periodMs = periodMs;
+    s_fileDurability.file = (LogStream::STDOUT == mLogStream) ? stdout : stderr;
+
+    if (LogDurability::DURABILITY_PERIODIC == durability)
+    {
+        if (0 == periodMs)
+        {
+            printf("Invalid Period (%u) passed, Defaulting to 1000 ms\n", periodMs);
+            s_fileDurability.periodMs = 1000;
+        }
+        printf("Syncing Log File every %u ms\n", s_fileDurability.periodMs);
+        s_fileDurability.periodic = std::thread(runLogFileSync, &s_fileDurability);
+    }
+    else if (LogDurability::DURABILITY_SYNC_ON_LEVEL == durability)
+    {
+        printf("Syncing Log File for Log Level till %d\n", static_cast<unsigned char>(syncLevel));
+    }
+
+    // Set the Flag for Initalize
+    mIsLogDurabilityInitalized = true;
+
+    return;
+}
+
+bool Logger::flush(bool durable)
+{
+#ifndef _WIN32
+    LogSocketSink *sink = s_socketSink;
+    if (NULL != sink)
+    {
+        // Wait till the queued logs are sent to the socket (or timeout)
+        return flushLogSocket(sink);
+    }
+#endif // _WIN32
+
+    if (mIsSetLogFileInitalized)
+    {
+        FILE *file = (LogStream::STDOUT == mLogStream) ? stdout : stderr;
+        unsigned long long record;
+        {
+            std::lock_guard<std::mutex> lock(s_logMutex);
+            record = s_fileDurability.written;
+            fflush(file);
+        }
+
+        if (durable)
+        {
+            s_fileDurability.file = file;
+            return syncLogFile(&s_fileDurability, record);
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(s_logMutex);
+        fflush((LogStream::STDOUT == mLogStream) ? stdout : stderr);
+    }
+
+    return true;
+}
+
+void Logger::setHexFormat(LogHexFormat format, size_t maxBytes)
+{
+    mHexFormat = format;
+    mHexMaxBytes = maxBytes;
+
+    printf("Setting Hex Format to %d (kernel: %s)\n", static_cast<unsigned char>(mHexFormat), hexKernelName());
+
+    return;
+}
+
+void Logger::setAllocator(const LogAllocator &allocator)
+{
+    if (NULL == allocator.allocate || NULL == allocator.deallocate)
+    {
+        printf("Invalid Allocator passed, allocate and deallocate are required\n");
+        return;
+    }
+
+    s_allocator = allocator;
+
+    return;
+}
+
 void Logger::fatal(const char *format, ...)
 {
     // Check if the Loglevel is Profile or less than the Fatal
@@ -395,7 +1529,7 @@ void Logger::fatal(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "FATAL", colorCodes[static_cast<unsigned char>(LogLevel::LOG_FATAL) - 1],
+    printLog(mLogStream, LogLevel::LOG_FATAL, "FATAL", colorCodes[static_cast<unsigned char>(LogLevel::LOG_FATAL) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -411,7 +1545,7 @@ void Logger::error(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "ERROR", colorCodes[static_cast<unsigned char>(LogLevel::LOG_ERROR) - 1],
+    printLog(mLogStream, LogLevel::LOG_ERROR, "ERROR", colorCodes[static_cast<unsigned char>(LogLevel::LOG_ERROR) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -427,7 +1561,7 @@ void Logger::warning(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "WARN", colorCodes[static_cast<unsigned char>(LogLevel::LOG_WARN) - 1],
+    printLog(mLogStream, LogLevel::LOG_WARN, "WARN", colorCodes[static_cast<unsigned char>(LogLevel::LOG_WARN) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -443,7 +1577,7 @@ void Logger::info(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "INFO", colorCodes[static_cast<unsigned char>(LogLevel::LOG_INFO) - 1],
+    printLog(mLogStream, LogLevel::LOG_INFO, "INFO", colorCodes[static_cast<unsigned char>(LogLevel::LOG_INFO) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -459,7 +1593,7 @@ void Logger::debug(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "DEBUG", colorCodes[static_cast<unsigned char>(LogLevel::LOG_DEBUG) - 1],
+    printLog(mLogStream, LogLevel::LOG_DEBUG, "DEBUG", colorCodes[static_cast<unsigned char>(LogLevel::LOG_DEBUG) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -475,7 +1609,7 @@ void Logger::trace(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "TRACE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_TRACE) - 1],
+    printLog(mLogStream, LogLevel::LOG_TRACE, "TRACE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_TRACE) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
@@ -491,13 +1625,124 @@ void Logger::profile(const char *format, ...)
     
     va_list args;
     va_start(args, format);
-    printLog(mLogStream, "PROFILE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_PROFILE) - 1],
+    printLog(mLogStream, LogLevel::LOG_PROFILE, "PROFILE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_PROFILE) - 1],
              format, args, mIsSetLogFileInitalized);
     va_end(args);
 
     return;
 }
 
+void Logger::fatalHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the Fatal
+    // If Less than Fatal, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_FATAL))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_FATAL, "FATAL", colorCodes[static_cast<unsigned char>(LogLevel::LOG_FATAL) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::errorHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the error
+    // If Less than error, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_ERROR))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_ERROR, "ERROR", colorCodes[static_cast<unsigned char>(LogLevel::LOG_ERROR) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::warningHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the warning
+    // If Less than warning, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_WARN))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_WARN, "WARN", colorCodes[static_cast<unsigned char>(LogLevel::LOG_WARN) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::infoHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the info
+    // If Less than info, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_INFO))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_INFO, "INFO", colorCodes[static_cast<unsigned char>(LogLevel::LOG_INFO) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::debugHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the debug
+    // If Less than debug, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_DEBUG))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_DEBUG, "DEBUG", colorCodes[static_cast<unsigned char>(LogLevel::LOG_DEBUG) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::traceHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile or less than the trace
+    // If Less than trace, return. as it is not requried to print
+    if ((mCurrLogLevel == LogLevel::LOG_PROFILE) || (mCurrLogLevel < LogLevel::LOG_TRACE))
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_TRACE, "TRACE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_TRACE) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+void Logger::profileHex(const char *label, const void *data, size_t length)
+{
+    // Check if the Loglevel is Profile
+    // If not profile, return. as it is not requried to print
+    if (mCurrLogLevel != LogLevel::LOG_PROFILE)
+        return;
+
+    printHexLog(mLogStream, LogLevel::LOG_PROFILE, "PROFILE", colorCodes[static_cast<unsigned char>(LogLevel::LOG_PROFILE) - 1],
+                mHexFormat, mHexMaxBytes, label, data, length, mIsSetLogFileInitalized);
+
+    return;
+}
+
+Logger::HexBuffer::HexBuffer(const void *data, size_t length)
+{
+    size_t encodeLength = (length > MAX_BYTES) ? MAX_BYTES : length;
+    encodeHex(mText, static_cast<const unsigned char *>(data), encodeLength);
+
+    size_t textLength = 2 * encodeLength;
+    if (encodeLength < length)
+    {
+        // Mark the truncated buffer
+        memcpy(mText + textLength, "...", 3);
+        textLength += 3;
+    }
+    mText[textLength] = '\0';
+}
+
+const char *Logger::HexBuffer::c_str() const
+{
+    return mText;
+}
+
 Logger::Logger()
 {
     // Set Default Log Level Values
@@ -515,6 +1760,27 @@ Logger::Logger()
     // Set mIsSetLogFileInitalized to false
     mIsSetLogFileInitalized = false;
 
+    // Set mIsSetLogSocketInitalized to false
+    mIsSetLogSocketInitalized = false;
+
+    // Set mIsLogDurabilityInitalized to false
+    mIsLogDurabilityInitalized = false;
+
+    // Set Default Hex Format for Binary Buffer Logs
+    mHexFormat = LogHexFormat::HEX_PLAIN;
+    mHexMaxBytes = 4096;
+
+    // Set Default Durability (no sync) for Log File
+    s_fileDurability.mode = LogDurability::DURABILITY_NONE;
+    s_fileDurability.syncLevel = LogLevel::LOG_OFF;
+    s_fileDurability.periodMs = 0;
+    s_fileDurability.file = NULL;
+    s_fileDurability.written = 0;
+    s_fileDurability.synced = 0;
+    s_fileDurability.lost = 0;
+    s_fileDurability.isSyncing = false;
+    s_fileDurability.stop = false;
+
 #ifdef _WIN32
     // Flag setting for Color in Windows Console
     HANDLE hInput = GetStdHandle(STD_INPUT_HANDLE);
@@ -0,0 +1,369 @@
+/**
+ * @file CppLoggerHex.cpp
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Hex Encoding Implementation for Cpp Logger (SSE2 / AVX2 with scalar fallback)
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ */
+// System Includes
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LOG_HEX_X86 1
+#define LOG_HEX_TARGET(isa) __attribute__((target(isa)))
+#define LOG_HEX_INLINE inline __attribute__((always_inline))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define LOG_HEX_X86 1
+#define LOG_HEX_TARGET(isa)
+#define LOG_HEX_INLINE __forceinline
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+// Logger Includes
+#include "CppLoggerHex.h"
+
+// Number of bytes encoded by a single kernel call in hexdump
+#define LOG_HEX_DUMP_CHUNK_BYTES (16 * LOG_HEX_DUMP_LINE_BYTES)
+
+/**
+ * @brief Hex Digits
+ */
+static const char hexDigits[] = "0123456789abcdef";
+
+/**
+ * @brief Hex kernel (selected once based on the CPU)
+ */
+struct HexKernel
+{
+    // Name of the kernel
+    const char *name;
+    // Encodes bytes as hex
+    void (*hex)(char *dst, const unsigned char *src, size_t length);
+    // Copies bytes, replacing non printable characters with '.'
+    void (*ascii)(char *dst, const unsigned char *src, size_t length);
+};
+
+/**
+ * @brief Scalar hex encoding
+ */
+static void encodeHexScalar(char *dst, const unsigned char *src, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        dst[2 * i] = hexDigits[src[i] >> 4];
+        dst[2 * i + 1] = hexDigits[src[i] & 0x0f];
+    }
+}
+
+/**
+ * @brief Scalar printable ASCII
+ */
+static void encodeAsciiScalar(char *dst, const unsigned char *src, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+        dst[i] = (src[i] >= 0x20 && src[i] < 0x7f) ? static_cast<char>(src[i]) : '.';
+}
+
+#ifdef LOG_HEX_X86
+/**
+ * @brief Converts nibbles (0 - 15) to hex digits
+ */
+LOG_HEX_TARGET("sse2")
+static LOG_HEX_INLINE __m128i nibblesToHexSSE2(__m128i nibbles)
+{
+    // '0' + n, plus ('a' - '0' - 10) for n > 9
+    __m128i isLetter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    __m128i digits = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+    return _mm_add_epi8(digits, _mm_and_si128(isLetter, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+/**
+ * @brief SSE2 hex encoding (16 bytes per step)
+ */
+LOG_HEX_TARGET("sse2")
+static void encodeHexSSE2(char *dst, const unsigned char *src, size_t length)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i high = nibblesToHexSSE2(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        __m128i low = nibblesToHexSSE2(_mm_and_si128(bytes, mask));
+
+        // Interleave high and low digits of each byte
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+    encodeHexScalar(dst + 2 * i, src + i, length - i);
+}
+
+/**
+ * @brief SSE2 printable ASCII (16 bytes per step)
+ */
+LOG_HEX_TARGET("sse2")
+static void encodeAsciiSSE2(char *dst, const unsigned char *src, size_t length)
+{
+    const __m128i dots = _mm_set1_epi8('.');
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        // Signed compare, so bytes >= 0x80 are not printable
+        __m128i isPrintable = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1f)),
+                                            _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7f)));
+        __m128i result = _mm_or_si128(_mm_and_si128(isPrintable, bytes), _mm_andnot_si128(isPrintable, dots));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), result);
+    }
+    encodeAsciiScalar(dst + i, src + i, length - i);
+}
+
+/**
+ * @brief Converts nibbles (0 - 15) to hex digits
+ */
+LOG_HEX_TARGET("avx2")
+static LOG_HEX_INLINE __m256i nibblesToHexAVX2(__m256i nibbles)
+{
+    __m256i isLetter = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    __m256i digits = _mm256_add_epi8(nibbles, _mm256_set1_epi8('0'));
+    return _mm256_add_epi8(digits, _mm256_and_si256(isLetter, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+/**
+ * @brief AVX2 hex encoding (32 bytes per step)
+ */
+LOG_HEX_TARGET("avx2")
+static void encodeHexAVX2(char *dst, const unsigned char *src, size_t length)
+{
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        __m256i high = nibblesToHexAVX2(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        __m256i low = nibblesToHexAVX2(_mm256_and_si256(bytes, mask));
+
+        // Unpack works within 128 bit lanes: first = bytes 0-7 | 16-23, second = bytes 8-15 | 24-31
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    encodeHexSSE2(dst + 2 * i, src + i, length - i);
+}
+
+/**
+ * @brief AVX2 printable ASCII (32 bytes per step)
+ */
+LOG_HEX_TARGET("avx2")
+static void encodeAsciiAVX2(char *dst, const unsigned char *src, size_t length)
+{
+    const __m256i dots = _mm256_set1_epi8('.');
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        __m256i isPrintable = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(0x1f)),
+                                               _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7f), bytes));
+        __m256i result = _mm256_or_si256(_mm256_and_si256(isPrintable, bytes), _mm256_andnot_si256(isPrintable, dots));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), result);
+    }
+    encodeAsciiSSE2(dst + i, src + i, length - i);
+}
+
+/**
+ * @brief Function to check the CPU (and OS) support for the instruction set
+ *
+ * @param isAVX2 true for AVX2, false for SSE2
+ * @return true
+ * @return false
+ */
+static bool isCpuSupported(bool isAVX2)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    if (!isAVX2)
+        return (info[3] & (1 << 26)) != 0;
+
+    // OSXSAVE and AVX, and the OS saves the YMM registers
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+        return false;
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return isAVX2 ? __builtin_cpu_supports("avx2") : __builtin_cpu_supports("sse2");
+#endif // _MSC_VER
+}
+#endif // LOG_HEX_X86
+
+/**
+ * @brief Function to select the hex kernel for this CPU
+ *
+ * @return HexKernel
+ */
+static HexKernel selectHexKernel()
+{
+#ifdef LOG_HEX_X86
+    if (isCpuSupported(true))
+        return HexKernel{"avx2", encodeHexAVX2, encodeAsciiAVX2};
+    if (isCpuSupported(false))
+        return HexKernel{"sse2", encodeHexSSE2, encodeAsciiSSE2};
+#endif // LOG_HEX_X86
+    return HexKernel{"scalar", encodeHexScalar, encodeAsciiScalar};
+}
+
+/**
+ * @brief Function to get the hex kernel (selected on first use)
+ *
+ * @return const HexKernel&
+ */
+static const HexKernel &getHexKernel()
+{
+    static const HexKernel kernel = selectHexKernel();
+    return kernel;
+}
+
+void encodeHex(char *dst, const unsigned char *src, size_t length)
+{
+    getHexKernel().hex(dst, src, length);
+}
+
+size_t hexDumpSize(size_t length)
+{
+    size_t lines = (length + LOG_HEX_DUMP_LINE_BYTES - 1) / LOG_HEX_DUMP_LINE_BYTES;
+    return lines * (LOG_HEX_DUMP_LINE_SIZE + 1);
+}
+
+size_t encodeHexDump(char *dst, const unsigned char *src, size_t length)
+{
+    const HexKernel &kernel = getHexKernel();
+    char hex[2 * LOG_HEX_DUMP_CHUNK_BYTES];
+    char *out = dst;
+
+    for (size_t chunk = 0; chunk < length; chunk += LOG_HEX_DUMP_CHUNK_BYTES)
+    {
+        // Encode many lines at once, then lay them out
+        size_t chunkLength = length - chunk;
+        if (chunkLength > LOG_HEX_DUMP_CHUNK_BYTES)
+            chunkLength = LOG_HEX_DUMP_CHUNK_BYTES;
+        kernel.hex(hex, src + chunk, chunkLength);
+
+        for (size_t line = 0; line < chunkLength; line += LOG_HEX_DUMP_LINE_BYTES)
+        {
+            size_t lineLength = chunkLength - line;
+            if (lineLength > LOG_HEX_DUMP_LINE_BYTES)
+                lineLength = LOG_HEX_DUMP_LINE_BYTES;
+
+            if (out != dst)
+                *out++ = '\n';
+
+            // Offset
+            unsigned int offset = static_cast<unsigned int>(chunk + line);
+            for (int shift = 28; shift >= 0; shift -= 4)
+                *out++ = hexDigits[(offset >> shift) & 0x0f];
+            *out++ = ' ';
+
+            // Hex bytes, with an extra space after 8 bytes
+            const char *lineHex = hex + 2 * line;
+            for (size_t i = 0; i < LOG_HEX_DUMP_LINE_BYTES; i++)
+            {
+                if (i % 8 == 0)
+                    *out++ = ' ';
+                if (i < lineLength)
+                {
+                    *out++ = lineHex[2 * i];
+                    *out++ = lineHex[2 * i + 1];
+                }
+                else
+                {
+                    *out++ = ' ';
+                    *out++ = ' ';
+                }
+                *out++ = ' ';
+            }
+
+            // Printable ASCII
+            *out++ = ' ';
+            *out++ = '|';
+            kernel.ascii(out, src + chunk + line, lineLength);
+            out += lineLength;
+            *out++ = '|';
+        }
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+size_t encodeHexText(char *dst, size_t available, const unsigned char *src, size_t length,
+                     size_t maxBytes, bool isHexDump)
+{
+    // Truncation marker
+    const char marker[] = "...";
+    const size_t markerLength = sizeof(marker) - 1;
+
+    size_t encodeLength = (maxBytes != 0 && length > maxBytes) ? maxBytes : length;
+    size_t textSize = isHexDump ? hexDumpSize(encodeLength) : 2 * encodeLength;
+    if (encodeLength < length)
+        textSize += markerLength;
+
+    if (textSize > available)
+    {
+        // Bytes which fit in the space, leaving space for the marker
+        size_t fitLength = 0;
+        if (available > markerLength)
+        {
+            size_t space = available - markerLength;
+            fitLength = isHexDump ? ((space + 1) / (LOG_HEX_DUMP_LINE_SIZE + 1)) * LOG_HEX_DUMP_LINE_BYTES : space / 2;
+        }
+        if (encodeLength > fitLength)
+            encodeLength = fitLength;
+    }
+
+    size_t textLength = 0;
+    if (isHexDump)
+    {
+        textLength = encodeHexDump(dst, src, encodeLength);
+    }
+    else
+    {
+        encodeHex(dst, src, encodeLength);
+        textLength = 2 * encodeLength;
+    }
+
+    if (encodeLength < length && textLength + markerLength <= available)
+    {
+        memcpy(dst + textLength, marker, markerLength);
+        textLength += markerLength;
+    }
+    return textLength;
+}
+
+const char *hexKernelName()
+{
+    return getHexKernel().name;
+}
+
+bool encodeWithHexKernel(const char *kernelName, bool isAscii, char *dst, const unsigned char *src, size_t length)
+{
+    HexKernel kernel = {"scalar", encodeHexScalar, encodeAsciiScalar};
+#ifdef LOG_HEX_X86
+    if (strcmp(kernelName, "avx2") == 0 && isCpuSupported(true))
+        kernel = HexKernel{"avx2", encodeHexAVX2, encodeAsciiAVX2};
+    else if (strcmp(kernelName, "sse2") == 0 && isCpuSupported(false))
+        kernel = HexKernel{"sse2", encodeHexSSE2, encodeAsciiSSE2};
+#endif // LOG_HEX_X86
+    if (strcmp(kernelName, kernel.name) != 0)
+        return false;
+
+    if (isAscii)
+        kernel.ascii(dst, src, length);
+    else
+        kernel.hex(dst, src, length);
+    return true;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file CppLoggerHex.h
+ * @author Brothers.AI (brothers.ai.local@gmail.com)
+ * @brief Hex Encoding Functions for Cpp Logger (internal)
+ * @version 0.1
+ * @date 2024-01-25
+ *
+ */
+#ifndef __CPP_LOGGER_HEX_H__
+#define __CPP_LOGGER_HEX_H__
+
+// System Includes
+#include <cstddef>
+
+// Number of bytes in a hexdump line
+#define LOG_HEX_DUMP_LINE_BYTES  16
+// Number of characters in a hexdump line (without newline)
+// "00000000  xx xx xx xx xx xx xx xx  xx xx xx xx xx xx xx xx  |................|"
+#define LOG_HEX_DUMP_LINE_SIZE   78
+
+/**
+ * @brief Function to encode bytes as lowercase hex (2 characters per byte, no null)
+ *
+ * @param dst destination (2 * length characters)
+ * @param src source bytes
+ * @param length number of bytes
+ */
+void encodeHex(char *dst, const unsigned char *src, size_t length);
+
+/**
+ * @brief Function to encode bytes as hexdump lines (offset, hex and ASCII), no null
+ *
+ * Lines are separated by newline, there is no newline after the last line.
+ *
+ * @param dst destination (hexDumpSize(length) characters)
+ * @param src source bytes
+ * @param length number of bytes
+ * @return size_t : number of characters written
+ */
+size_t encodeHexDump(char *dst, const unsigned char *src, size_t length);
+
+/**
+ * @brief Function to get the size of hexdump lines for the bytes
+ *
+ * @param length number of bytes
+ * @return size_t : number of characters
+ */
+size_t hexDumpSize(size_t length);
+
+/**
+ * @brief Function to encode bytes as hex or hexdump lines, truncated to fit the space
+ *
+ * Truncated buffers (by maxBytes or space) are marked with "..." at the end.
+ *
+ * @param dst destination
+ * @param available number of characters available in destination (no null is written)
+ * @param src source bytes
+ * @param length number of bytes
+ * @param maxBytes maximum bytes to encode (0 for no limit)
+ * @param isHexDump true for hexdump lines, false for plain hex
+ * @return size_t : number of characters written
+ */
+size_t encodeHexText(char *dst, size_t available, const unsigned char *src, size_t length,
+                     size_t maxBytes, bool isHexDump);
+
+/**
+ * @brief Function to get the name of the hex kernel selected for this CPU
+ *
+ * @return const char* : "avx2", "sse2" or "scalar"
+ */
+const char *hexKernelName();
+
+/**
+ * @brief Function to encode with a given kernel (used to check the kernels against the scalar one)
+ *
+ * @param kernelName "avx2", "sse2" or "scalar"
+ * @param isAscii true for printable ASCII (length characters), false for hex (2 * length characters)
+ * @param dst destination
+ * @param src source bytes
+ * @param length number of bytes
+ * @return true
+ * @return false : kernel is not available on this CPU / build
+ */
+bool encodeWithHexKernel(const char *kernelName, bool isAscii, char *dst, const unsigned char *src, size_t length);
+
+#endif // __CPP_LOGGER_HEX_H__